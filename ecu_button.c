@@ -10,6 +10,22 @@
 #include "ecu_button.h"
 /***********************************************************************/
 
+/*****************Helper Functions Declarations-Section*****************/
+#if BUTTON_GESTURE_CFG==CONFIG_ENABLE
+/* @Brief : Push Button gesture recognizer phases. */
+#define BUTTON_PHASE_IDLE           0
+#define BUTTON_PHASE_PRESSED        1
+#define BUTTON_PHASE_RELEASED_ONCE  2
+#define BUTTON_PHASE_PRESSED_TWICE  3
+#define BUTTON_PHASE_HELD           4
+
+/*
+ * @Brief : Timestamp shared by all Push Buttons, advanced by button_gesture_tick.
+ */
+static volatile uint16 button_timestamp = ZERO_INT;
+#endif
+/***********************************************************************/
+
 /*****************Software Interfaces Functions-Section*****************/
 /*
  * @Brief              : Initialize the assigned pin to be Input.
@@ -79,4 +95,150 @@ Std_ReturnType button_read_state(const button_t *btn, button_state_t *btn_state)
     }
     return ret;
 }
+
+#if BUTTON_GESTURE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To advance the timestamp shared by all Push Buttons, called from a periodic timer interrupt.
+ */
+void button_gesture_tick(void)
+{
+    button_timestamp++;
+}
+
+/*
+ * @Brief              : Initialize the Push Button pin and its gesture state.
+ * @Param btn          : Pointer to the Push Button configurations.
+ * @Param gesture      : Pointer to the Push Button gesture state.
+ * @Return  Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType button_gesture_initialize(const button_t *btn, button_gesture_t *gesture)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == btn) || (NULL == gesture))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = button_initialize(btn);
+        gesture->raw_time = button_timestamp;
+        gesture->event_time = gesture->raw_time;
+        gesture->raw_pressed = ZERO_INT;
+        gesture->pressed = ZERO_INT;
+        gesture->phase = BUTTON_PHASE_IDLE;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read the Push Button and recognize its gestures, called often from the main loop.
+ * @Param btn          : Pointer to the Push Button configurations.
+ * @Param gesture      : Pointer to the Push Button gesture state.
+ * @Param event        : Pointer to the recognized gesture, BUTTON_EVENT_NONE if there is no gesture.
+ * @Return  Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType button_gesture_update(const button_t *btn, button_gesture_t *gesture, button_event_t *event)
+{
+    Std_ReturnType ret = E_OK;
+    button_state_t l_btn_state = BUTTON_RELEASED;
+    uint16 l_now = ZERO_INT;
+    uint16 l_elapsed = ZERO_INT;
+    uint8 l_changed = STD_OFF;
+    uint8 l_pressed = ZERO_INT;
+    if((NULL == btn) || (NULL == gesture) || (NULL == event))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *event = BUTTON_EVENT_NONE;
+        /* @Brief : The timestamp is 16-Bits, read it again if the tick changed it in between. */
+        do
+        {
+            l_now = button_timestamp;
+        }while(l_now != button_timestamp);
+        ret = button_read_state(btn, &l_btn_state);
+        l_pressed = (BUTTON_PRESSED == l_btn_state) ? 1 : 0;
+        /* @Brief : Debounce, the level is accepted when it is stable for BUTTON_DEBOUNCE_TICKS. */
+        if(l_pressed != gesture->raw_pressed)
+        {
+            gesture->raw_pressed = l_pressed;
+            gesture->raw_time = l_now;
+        }
+        else if((gesture->pressed != l_pressed) && ((uint16)(l_now - gesture->raw_time) >= BUTTON_DEBOUNCE_TICKS))
+        {
+            gesture->pressed = l_pressed;
+            l_changed = STD_ON;
+        }
+        else{/*****Nothing*****/}
+        l_elapsed = (uint16)(l_now - gesture->event_time);
+        switch(gesture->phase)
+        {
+            case BUTTON_PHASE_IDLE :
+                if(STD_ON == l_changed)
+                {
+                    gesture->phase = (1 == gesture->pressed) ? BUTTON_PHASE_PRESSED : BUTTON_PHASE_IDLE;
+                    gesture->event_time = l_now;
+                }
+                else{/*****Nothing*****/}
+                break;
+            case BUTTON_PHASE_PRESSED :
+                if(STD_ON == l_changed)
+                {
+                    gesture->phase = BUTTON_PHASE_RELEASED_ONCE;
+                    gesture->event_time = l_now;
+                }
+                else if(l_elapsed >= BUTTON_LONG_PRESS_TICKS)
+                {
+                    *event = BUTTON_EVENT_LONG_PRESS;
+                    gesture->phase = BUTTON_PHASE_HELD;
+                    gesture->event_time = l_now;
+                }
+                else{/*****Nothing*****/}
+                break;
+            case BUTTON_PHASE_RELEASED_ONCE :
+                if(STD_ON == l_changed)
+                {
+                    gesture->phase = BUTTON_PHASE_PRESSED_TWICE;
+                    gesture->event_time = l_now;
+                }
+                else if(l_elapsed >= BUTTON_DOUBLE_CLICK_TICKS)
+                {
+                    *event = BUTTON_EVENT_CLICK;
+                    gesture->phase = BUTTON_PHASE_IDLE;
+                }
+                else{/*****Nothing*****/}
+                break;
+            case BUTTON_PHASE_PRESSED_TWICE :
+                if(STD_ON == l_changed)
+                {
+                    *event = BUTTON_EVENT_DOUBLE_CLICK;
+                    gesture->phase = BUTTON_PHASE_IDLE;
+                    gesture->event_time = l_now;
+                }
+                else{/*****Nothing*****/}
+                break;
+            case BUTTON_PHASE_HELD :
+                if(STD_ON == l_changed)
+                {
+                    gesture->phase = BUTTON_PHASE_IDLE;
+                    gesture->event_time = l_now;
+                }
+                else if(l_elapsed >= BUTTON_REPEAT_TICKS)
+                {
+                    *event = BUTTON_EVENT_HOLD_REPEAT;
+                    gesture->event_time = l_now;
+                }
+                else{/*****Nothing*****/}
+                break;
+            default : gesture->phase = BUTTON_PHASE_IDLE;
+        }
+    }
+    return ret;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
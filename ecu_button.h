@@ -44,6 +44,29 @@ typedef struct
     button_state_t button_state;             /* @Brief : Push Button Status configuration. */
     button_active_t button_connection;       /* @Brief : Push Button connection Status configuration. */
 }button_t;
+
+#if BUTTON_GESTURE_CFG==CONFIG_ENABLE
+/* @Brief : Push Button gesture events. */
+typedef enum
+{
+    BUTTON_EVENT_NONE = 0,      /* @Brief : No gesture. */
+    BUTTON_EVENT_CLICK,         /* @Brief : One short press. */
+    BUTTON_EVENT_DOUBLE_CLICK,  /* @Brief : Two short presses. */
+    BUTTON_EVENT_LONG_PRESS,    /* @Brief : Press held for BUTTON_LONG_PRESS_TICKS. */
+    BUTTON_EVENT_HOLD_REPEAT    /* @Brief : Every BUTTON_REPEAT_TICKS while held after a long press. */
+}button_event_t;
+
+/* @Brief : Push Button gesture state, one for each Push Button. */
+typedef struct
+{
+    uint16 raw_time;            /* @Brief : Timestamp of the last pin level change. */
+    uint16 event_time;          /* @Brief : Timestamp of the last accepted change or event. */
+    uint8 raw_pressed : 1;      /* @Brief : Last pin level, 1 for pressed. */
+    uint8 pressed : 1;          /* @Brief : Debounced level, 1 for pressed. */
+    uint8 phase : 3;            /* @Brief : Gesture recognizer phase. */
+    uint8 reserved : 3;         /* @Brief : Reserved bits. */
+}button_gesture_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -65,6 +88,34 @@ Std_ReturnType button_initialize(const button_t *btn);
  *          (E_NOT_OK) : The function has issue while performing this action.
  */
 Std_ReturnType button_read_state(const button_t *btn, button_state_t *btn_state);
+
+#if BUTTON_GESTURE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To advance the timestamp shared by all Push Buttons, called from a periodic timer interrupt.
+ */
+void button_gesture_tick(void);
+
+/*
+ * @Brief              : Initialize the Push Button pin and its gesture state.
+ * @Param btn          : Pointer to the Push Button configurations.
+ * @Param gesture      : Pointer to the Push Button gesture state.
+ * @Return  Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType button_gesture_initialize(const button_t *btn, button_gesture_t *gesture);
+
+/*
+ * @Brief              : To read the Push Button and recognize its gestures, called often from the main loop.
+ * @Param btn          : Pointer to the Push Button configurations.
+ * @Param gesture      : Pointer to the Push Button gesture state.
+ * @Param event        : Pointer to the recognized gesture, BUTTON_EVENT_NONE if there is no gesture.
+ * @Return  Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType button_gesture_update(const button_t *btn, button_gesture_t *gesture, button_event_t *event);
+#endif
 /***********************************************************************/
 #endif	/* ECU__BUTTON_H */
 
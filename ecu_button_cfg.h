@@ -14,7 +14,20 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
-
+/* 
+ * @Brief : Macro to enable the Push Button gestures (click, double click, long press and hold repeat).
+ * @Note  : Times are in ticks of button_gesture_tick, 1 ms ticks are assumed below.
+ */
+#define BUTTON_GESTURE_CFG              CONFIG_ENABLE
+
+/* @Brief : Macro for the time the Push Button level has to be stable to be accepted. */
+#define BUTTON_DEBOUNCE_TICKS           20
+/* @Brief : Macro for the maximum time between a release and the second press of a double click. */
+#define BUTTON_DOUBLE_CLICK_TICKS       300
+/* @Brief : Macro for the press time of a long press. */
+#define BUTTON_LONG_PRESS_TICKS         800
+/* @Brief : Macro for the time between hold repeat events after a long press. */
+#define BUTTON_REPEAT_TICKS             200
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
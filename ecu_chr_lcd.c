@@ -11,58 +11,259 @@
 /***********************************************************************/
 
 /*****************Helper Functions Declarations-Section*****************/
+/* @Brief : Macros for Character LCD data bus width. */
+#define LCD_4BIT_BUS_WIDTH  4
+#define LCD_8BIT_BUS_WIDTH  8
+
+/* 
+ * @Brief : Macro function to build the common bus view of a 4-Bit or 8-Bit Character LCD.
+ * @Note  : The view points to the members of the Character LCD object, the object is never 
+ *          accessed through a pointer to another structure type.
+ */
+#define LCD_BUS(_LCD)       (&(const chr_lcd_bus_t){&((_LCD)->lcd_rs), &((_LCD)->lcd_en), (_LCD)->lcd_data, \
+                                                     &((_LCD)->lcd_fast_bus)})
+
+/* 
+ * @Brief : Character LCD common bus view.
+ * @Note  : Only the number of data pins differs between chr_4bit_lcd_t and chr_8bit_lcd_t, 
+ *          it is passed as bus width.
+ */
+typedef struct
+{
+    const pin_config_t *lcd_rs;      /* @Brief : Character LCD rs pin configuration. */
+    const pin_config_t *lcd_en;      /* @Brief : Character LCD en pin configuration. */
+    const pin_config_t *lcd_data;    /* @Brief : Character LCD data pins configuration. */
+    const uint8 *lcd_fast_bus;       /* @Brief : STD_ON when the data pins are written with one latch update. */
+}chr_lcd_bus_t;
+
+/* @Brief : Character LCD initialization sequence step. */
+typedef struct
+{
+    uint8 command;          /* @Brief : Command sent to the Character LCD. */
+    uint8 delay_steps;      /* @Brief : Delay after the command in LCD_INIT_DELAY_STEP_US steps. */
+}lcd_init_step_t;
+
+/* @Brief : Macro for Character LCD initialization sequence delay step in micro seconds. */
+#define LCD_INIT_DELAY_STEP_US      100
+/* @Brief : Macro for Character LCD initialization sequence number of steps. */
+#define LCD_INIT_SEQUENCE_LENGTH    (sizeof(lcd_init_sequence) / sizeof(lcd_init_sequence[0]))
+/* @Brief : Macro for Character LCD initialization sequence step of the bus width function set. */
+#define LCD_INIT_FUNCTION_SET       7
+
+/* 
+ * @Brief : Character LCD initialization sequence, kept in program memory and read step by step.
+ * @Note  : The function set step is sent as _LCD_4BIT_MODE_2_LINE for the 4-Bit Character LCD.
+ */
+static const lcd_init_step_t lcd_init_sequence[] =
+{
+    {_LCD_8BIT_MODE_2_LINE, 50},
+    {_LCD_8BIT_MODE_2_LINE, 2},
+    {_LCD_8BIT_MODE_2_LINE, 0},
+    {_LCD_CLEAR, 20},
+    {_LCD_RETURN_HOME, 20},
+    {_LCD_ENTRY_MODE_INC_SHIFT_OFF, 0},
+    {_LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF, 0},
+    {_LCD_8BIT_MODE_2_LINE, 0},
+    {_LCD_DDRAM_START, 0}
+};
+
 /*
- * @Brief              :  Used to send commands for 4-Bits Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To initialize the Character LCD pins and send the initialization commands.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param fast_bus     : Pointer to the fast bus flag of the Character LCD object.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_intialize(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 *fast_bus);
+
+/*
+ * @Brief              : To send command or data byte to the Character LCD, this is the only bus width dependent part.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param rs_logic     : (GPIO_LOW) for command register, (GPIO_HIGH) for data register.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_write_bus(const chr_lcd_bus_t *lcd, uint8 bus_width, logic_t rs_logic, uint8 value);
+
+/*
+ * @Brief              : Used to put commands or data on the Character LCD data pins.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
  * @Param _data_command.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_send_4bits(const chr_4bit_lcd_t *lcd, uint8 _data_command);
+static Std_ReturnType lcd_send_data_pins(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 _data_command);
 
 /*
- * @Brief              : To send enable signal for 4-Bit Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To send enable signal for Character LCD.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_4bit_send_enable_signal(const chr_4bit_lcd_t *lcd);
+static Std_ReturnType lcd_send_enable_signal(const chr_lcd_bus_t *lcd);
 
 /*
- * @Brief              : To set cursor of 4-Bit Character LCD in specific column and row.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To set cursor of Character LCD in specific column and row.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_4bit_set_cursor(const chr_4bit_lcd_t *lcd, uint8 row, uint8 coulmn);
+static Std_ReturnType lcd_core_set_cursor(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 row, uint8 coulmn);
 
 /*
- * @Brief              : To send enable signal for 8-Bit Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To print a string on Character LCD.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param str
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_8bit_send_enable_signal(const chr_8bit_lcd_t *lcd);
+static Std_ReturnType lcd_core_send_string(const chr_lcd_bus_t *lcd, uint8 bus_width, const uint8 *str);
 
 /*
- * @Brief              : To set cursor of 8-Bit Character LCD in specific column and row.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To print custom character in specific row and column on Character LCD. 
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr
+ * @Param mem_pos
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_send_custom_char(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 row, uint8 column, 
+                                                const uint8 _chr[], uint8 mem_pos);
+
+/*
+ * @Brief              : To upload the rows of a custom character to one CGRAM slot.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param _chr
+ * @Param mem_pos      : CGRAM slot of the custom character.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_upload_glyph(const chr_lcd_bus_t *lcd, uint8 bus_width, const uint8 _chr[], uint8 mem_pos);
+
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph, on a miss the least recently used slot is replaced.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code of the glyph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_glyph_cache_get(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                               const uint8 _chr[], uint8 *slot);
+#endif
+
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/* @Brief : Macros for Character LCD big number font cells, values below LCD_BIG_GLYPHS_NUMBER are glyphs. */
+#define LCD_BIG_GLYPH_UPPER     0
+#define LCD_BIG_GLYPH_LOWER     1
+#define LCD_BIG_GLYPH_BOTH      2
+#define LCD_BIG_GLYPHS_NUMBER   3
+#define LCD_BIG_CELL_FULL       0xFF
+#define LCD_BIG_CELL_SPACE      0x20
+/* @Brief : Macro for Character LCD big number font entry of blanked leading zero. */
+#define LCD_BIG_DIGIT_BLANK     10
+
+/* @Brief : Bar graph partial cell glyphs, 1 to 4 pixel columns filled from the left. */
+static const uint8 lcd_bar_graph_glyphs[LCD_BAR_GRAPH_CELL_LEVELS - 1][LCD_GLYPH_ROWS_NUMBER] =
+{
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C},
+    {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}
+};
+
+/* @Brief : Big number glyphs, upper bar, lower bar and both bars. */
+static const uint8 lcd_big_number_glyphs[LCD_BIG_GLYPHS_NUMBER][LCD_GLYPH_ROWS_NUMBER] =
+{
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F},
+    {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F}
+};
+
+/* @Brief : Big number font, upper row cells then lower row cells of every digit. */
+static const uint8 lcd_big_number_font[LCD_BIG_DIGIT_BLANK + 1][2 * LCD_BIG_DIGIT_WIDTH] =
+{
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_UPPER, LCD_BIG_CELL_FULL,  LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_GLYPH_UPPER, LCD_BIG_CELL_FULL,   LCD_BIG_CELL_SPACE, LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER},
+    {LCD_BIG_GLYPH_BOTH,  LCD_BIG_GLYPH_BOTH,  LCD_BIG_CELL_FULL,  LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER, LCD_BIG_GLYPH_LOWER},
+    {LCD_BIG_GLYPH_BOTH,  LCD_BIG_GLYPH_BOTH,  LCD_BIG_CELL_FULL,  LCD_BIG_GLYPH_LOWER, LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_BOTH,  LCD_BIG_GLYPH_BOTH, LCD_BIG_GLYPH_LOWER, LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_BOTH,  LCD_BIG_GLYPH_BOTH, LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_GLYPH_UPPER, LCD_BIG_GLYPH_UPPER, LCD_BIG_CELL_FULL,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_BOTH,  LCD_BIG_CELL_FULL,  LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_FULL,   LCD_BIG_GLYPH_BOTH,  LCD_BIG_CELL_FULL,  LCD_BIG_GLYPH_LOWER, LCD_BIG_GLYPH_LOWER, LCD_BIG_CELL_FULL},
+    {LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE, LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE,  LCD_BIG_CELL_SPACE}
+};
+
+/*
+ * @Brief              : To draw the cells of a bar graph changed since the last update.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param level        : Bar graph level, LCD_BAR_GRAPH_CELL_LEVELS for each cell.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_bar_graph_update(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                                lcd_bar_graph_t *bar, uint8 level);
+
+/*
+ * @Brief              : To draw the digits of a big number changed since the last update.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_8bit_set_cursor(const chr_8bit_lcd_t *lcd, uint8 row, uint8 coulmn);
+static Std_ReturnType lcd_core_big_number_update(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                                 lcd_big_number_t *number, uint16 value);
+#endif
+
+#if LCD_CONTIGUOUS_BUS_FAST_WRITE==CONFIG_ENABLE
+/*
+ * @Brief               : To check if the Character LCD data pins are contiguous bits of one port.
+ * @Param _data_pins    : The Character LCD data pins configurations, least significant bit first.
+ * @Param _pins_number  : Number of the data pins (4 or 8).
+ * @Return Status of the data pins.
+ *          (STD_ON)    : The data pins are contiguous on one port.
+ *          (STD_OFF)   : The data pins have to be written one by one.
+ */
+static uint8 lcd_data_pins_contiguous(const pin_config_t _data_pins[], uint8 _pins_number);
+#endif
 /***********************************************************************/
 
 /*****************Software Interfaces Functions-Section*****************/
+#if LCD_4BIT_MODE_CFG==CONFIG_ENABLE
 /* 
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the 4-Bit Character LCD OFF or ON.
  * @Param lcd          : Pointer to the Character LCD module configurations.
@@ -70,35 +271,16 @@ static Std_ReturnType lcd_8bit_set_cursor(const chr_8bit_lcd_t *lcd, uint8 row,
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType lcd_4bit_intialize(const chr_4bit_lcd_t *lcd)
+Std_ReturnType lcd_4bit_intialize(chr_4bit_lcd_t *lcd)
 {
     Std_ReturnType ret = E_OK;
-    uint8 l_data_pins_counter = ZERO_INT;
     if(NULL == lcd)
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        ret = gpio_pin_intialize(&(lcd->lcd_rs)); 
-        ret = gpio_pin_intialize(&(lcd->lcd_en));
-        for(l_data_pins_counter = ZERO_INT; l_data_pins_counter < 4; l_data_pins_counter++)
-        {
-            ret = gpio_pin_intialize(&(lcd->lcd_data[l_data_pins_counter]));
-        }
-        __delay_ms(20);
-        ret = lcd_4bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        __delay_ms(5);
-        ret = lcd_4bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        __delay_us(150);
-        ret = lcd_4bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        
-        ret = lcd_4bit_send_command(lcd, _LCD_CLEAR);
-        ret = lcd_4bit_send_command(lcd, _LCD_RETURN_HOME);
-        ret = lcd_4bit_send_command(lcd, _LCD_ENTRY_MODE_INC_SHIFT_OFF);
-        ret = lcd_4bit_send_command(lcd, _LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF);
-        ret = lcd_4bit_send_command(lcd, _LCD_4BIT_MODE_2_LINE);
-        ret = lcd_4bit_send_command(lcd, 0x80);
+        ret = lcd_core_intialize(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, &(lcd->lcd_fast_bus));
     }
     return ret;
 }
@@ -120,11 +302,7 @@ Std_ReturnType lcd_4bit_send_command(const chr_4bit_lcd_t *lcd, uint8 command)
     }
     else
     {
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs), GPIO_LOW);
-        ret = lcd_send_4bits(lcd, command >> 4);
-        ret = lcd_4bit_send_enable_signal(lcd);
-        ret = lcd_send_4bits(lcd, command);
-        ret = lcd_4bit_send_enable_signal(lcd);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, GPIO_LOW, command);
     }
     return ret;
 }
@@ -146,11 +324,7 @@ Std_ReturnType lcd_4bit_send_char_data(const chr_4bit_lcd_t *lcd, uint8 data)
     }
     else
     {    
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs), GPIO_HIGH);
-        ret = lcd_send_4bits(lcd, data >> 4);
-        ret = lcd_4bit_send_enable_signal(lcd);
-        ret = lcd_send_4bits(lcd, data);
-        ret = lcd_4bit_send_enable_signal(lcd);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, GPIO_HIGH, data);
     }
     return ret;
 }
@@ -174,8 +348,8 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const chr_4bit_lcd_t *lcd,uint8 row,
     }
     else
     {    
-        ret = lcd_4bit_set_cursor(lcd, row, column);
-        ret = lcd_4bit_send_char_data(lcd, data);
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, row, column);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, GPIO_HIGH, data);
     }
     return ret;
 }
@@ -191,16 +365,13 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const chr_4bit_lcd_t *lcd,uint8 row,
 Std_ReturnType lcd_4bit_send_string(const chr_4bit_lcd_t *lcd, uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        while(*str)
-        {
-            ret = lcd_4bit_send_char_data(lcd, *str++);
-        }
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, str);
     }
     return ret;
 }
@@ -218,17 +389,61 @@ Std_ReturnType lcd_4bit_send_string(const chr_4bit_lcd_t *lcd, uint8 *str)
 Std_ReturnType lcd_4bit_send_string_pos(const chr_4bit_lcd_t *lcd, uint8 row, uint8 column, uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
     { 
-        ret = lcd_4bit_set_cursor(lcd, row, column);
-        while(*str)
-        {
-            ret = lcd_4bit_send_char_data(lcd, *str++);
-        }
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, row, column);
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, str);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To print a constant string kept in program memory on 4-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD configurations.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_const_string(const chr_4bit_lcd_t *lcd, const uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == str))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, str);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To print a constant string kept in program memory on 4-Bit Character LCD in specific row and column.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_const_string_pos(const chr_4bit_lcd_t *lcd, uint8 row, uint8 column, const uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == str))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, row, column);
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, str);
     }
     return ret;
 }
@@ -239,7 +454,9 @@ Std_ReturnType lcd_4bit_send_string_pos(const chr_4bit_lcd_t *lcd, uint8 row, ui
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
  * @Param _chr
- * @Param mem_pos
+ * @Param mem_pos      : CGRAM slot, below LCD_CUSTOM_CHAR_SLOTS_NUMBER.
+ * @Note               : With LCD_GLYPH_CACHE_CFG only the LCD_GLYPH_CACHE_RESERVED_SLOTS first slots are 
+ *                       accepted, the other slots belong to the glyph cache.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
@@ -248,23 +465,135 @@ Std_ReturnType lcd_4bit_send_custom_char(const chr_4bit_lcd_t *lcd, uint8 row, u
                                          const uint8 _chr[], uint8 mem_pos)
 {
     Std_ReturnType ret = E_OK;
-    uint8 lcd_counter = ZERO_INT;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == _chr) || (mem_pos >= LCD_CUSTOM_CHAR_SLOTS_NUMBER))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_send_custom_char(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, row, column, _chr, mem_pos);
+    }
+    return ret;
+}
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph on 4-Bit Character LCD, the glyph is uploaded only if it is not loaded.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code to be sent to print the glyph.
+ * @Note               : After uploading a glyph the cursor has to be set again before printing.
+ *                       A full cache replaces its least recently used slot, every cell still showing 
+ *                       the replaced glyph changes to the new one.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_glyph_cache_get(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                        const uint8 _chr[], uint8 *slot)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == _chr) || (NULL == slot))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_glyph_cache_get(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, cache, _chr, slot);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To print a cached glyph in specific row and column on 4-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr         : The glyph rows.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_glyph_pos(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                       uint8 row, uint8 column, const uint8 _chr[])
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot = ZERO_INT;
+    if((NULL == lcd) || (NULL == cache) || (NULL == _chr))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_glyph_cache_get(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, cache, _chr, &l_slot);
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, row, column);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, GPIO_HIGH, l_slot);
+    }
+    return ret;
+}
+#endif
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To update a bar graph on 4-Bit Character LCD, only the changed cells are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param value        : Value shown by the bar graph.
+ * @Param full_scale   : Value of the full bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_bar_graph_update(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                         lcd_bar_graph_t *bar, uint16 value, uint16 full_scale)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == bar) || (ZERO_INT == full_scale))
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        ret = lcd_4bit_send_command(lcd, (_LCD_CGRAM_START+(mem_pos*8)));
-        for(lcd_counter = 0; lcd_counter <= 7; ++lcd_counter)
+        if(value > full_scale)
         {
-            ret = lcd_4bit_send_char_data(lcd, _chr[lcd_counter]);
+            value = full_scale;
         }
-        ret = lcd_4bit_send_char_data_pos(lcd, row, column, mem_pos);
+        else{/*****Nothing*****/}
+        ret = lcd_core_bar_graph_update(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, cache, bar, 
+                                        (uint8)(((uint32)value * bar->cells_number * LCD_BAR_GRAPH_CELL_LEVELS) / full_scale));
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To update a big number on 4-Bit Character LCD, only the changed digits are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_big_number_update(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                          lcd_big_number_t *number, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == number))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_big_number_update(LCD_BUS(lcd), LCD_4BIT_BUS_WIDTH, cache, number, value);
     }
     return ret;
 }
+#endif
+#endif
 
+#if LCD_8BIT_MODE_CFG==CONFIG_ENABLE
 /* 
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the 8-Bit Character LCD OFF or ON.
  * @Param lcd          : Pointer to the Character LCD module configurations.
@@ -272,35 +601,16 @@ Std_ReturnType lcd_4bit_send_custom_char(const chr_4bit_lcd_t *lcd, uint8 row, u
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType lcd_8bit_intialize(const chr_8bit_lcd_t *lcd)
+Std_ReturnType lcd_8bit_intialize(chr_8bit_lcd_t *lcd)
 {
     Std_ReturnType ret = E_OK;
-    uint8 l_data_pins_counter = ZERO_INT;
     if(NULL == lcd)
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        ret = gpio_pin_intialize(&(lcd->lcd_rs));
-        ret = gpio_pin_intialize(&(lcd->lcd_en));
-        for(l_data_pins_counter = ZERO_INT; l_data_pins_counter < 8; l_data_pins_counter++)
-        {
-            ret = gpio_pin_intialize(&(lcd->lcd_data[l_data_pins_counter]));
-        }
-        __delay_ms(20);
-        ret = lcd_8bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        __delay_ms(5);
-        ret = lcd_8bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        __delay_us(150);
-        ret = lcd_8bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        
-        ret = lcd_8bit_send_command(lcd, _LCD_CLEAR);
-        ret = lcd_8bit_send_command(lcd, _LCD_RETURN_HOME);
-        ret = lcd_8bit_send_command(lcd, _LCD_ENTRY_MODE_INC_SHIFT_OFF);
-        ret = lcd_8bit_send_command(lcd, _LCD_DISPLAY_ON_UNDERLINE_OFF_CURSOR_OFF);
-        ret = lcd_8bit_send_command(lcd, _LCD_8BIT_MODE_2_LINE);
-        ret = lcd_8bit_send_command(lcd, 0x80);
+        ret = lcd_core_intialize(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, &(lcd->lcd_fast_bus));
     }
     return ret;
 }
@@ -316,20 +626,13 @@ Std_ReturnType lcd_8bit_intialize(const chr_8bit_lcd_t *lcd)
 Std_ReturnType lcd_8bit_send_command(const chr_8bit_lcd_t *lcd, uint8 command)
 {
     Std_ReturnType ret = E_OK;
-    uint8 l_pin_counter = ZERO_INT;
     if(NULL == lcd)
     {
         ret = E_NOT_OK;
     }
     else
     {
-       
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs), GPIO_LOW);
-        for(l_pin_counter = 0; l_pin_counter < 8; ++l_pin_counter)
-        {
-            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_pin_counter]), (command >> l_pin_counter) & (uint8)0x01);
-        }
-        ret = lcd_8bit_send_enable_signal(lcd);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, GPIO_LOW, command);
     }
     return ret;
 }
@@ -345,19 +648,13 @@ Std_ReturnType lcd_8bit_send_command(const chr_8bit_lcd_t *lcd, uint8 command)
 Std_ReturnType lcd_8bit_send_char_data(const chr_8bit_lcd_t *lcd, uint8 data)
 {
     Std_ReturnType ret = E_OK;
-    uint8 l_pin_counter = ZERO_INT;
     if(NULL == lcd)
     {
         ret = E_NOT_OK;
     }
     else
-    {
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs), GPIO_HIGH);
-        for(l_pin_counter=0; l_pin_counter<8; ++l_pin_counter)
-        {
-            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_pin_counter]), (data >> l_pin_counter) & (uint8)0x01);
-        }
-        ret = lcd_8bit_send_enable_signal(lcd);
+    {    
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, GPIO_HIGH, data);
     }
     return ret;
 }
@@ -381,8 +678,8 @@ Std_ReturnType lcd_8bit_send_char_data_pos(const chr_8bit_lcd_t *lcd,uint8 row,
     }
     else
     {    
-        ret = lcd_8bit_set_cursor(lcd, row, column);
-        ret = lcd_8bit_send_char_data(lcd, data);
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, row, column);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, GPIO_HIGH, data);
     }
     return ret;
 }
@@ -398,16 +695,13 @@ Std_ReturnType lcd_8bit_send_char_data_pos(const chr_8bit_lcd_t *lcd,uint8 row,
 Std_ReturnType lcd_8bit_send_string(const chr_8bit_lcd_t *lcd, uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        while(*str)
-        {
-            ret = lcd_8bit_send_char_data(lcd, *str++);
-        }
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, str);
     }
     return ret;
 }
@@ -425,104 +719,346 @@ Std_ReturnType lcd_8bit_send_string(const chr_8bit_lcd_t *lcd, uint8 *str)
 Std_ReturnType lcd_8bit_send_string_pos(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
-    {    
-        ret = lcd_8bit_set_cursor(lcd, row, column);
-        ret = lcd_8bit_send_string(lcd, str);
+    { 
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, row, column);
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, str);
     }
     return ret;
 }
 
 /*
- * @Brief              : To print custom character in specific row and column on 8-Bit Character LCD. 
- * @Param lcd          : Pointer to the Character LCD module configurations.
- * @Param row          : To select which row you need to print your character.
- * @Param coulmn       : To select which column you need to print your character.
- * @Param _chr
- * @Param mem_pos
+ * @Brief              : To print a constant string kept in program memory on 8-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD configurations.
+ * @Param str          : Pointer to the constant string.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType lcd_8bit_send_custom_char(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, 
-                                         const uint8 _chr[], uint8 mem_pos)
+Std_ReturnType lcd_8bit_send_const_string(const chr_8bit_lcd_t *lcd, const uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    uint8 lcd_counter = ZERO_INT;
-    if(NULL == lcd)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        ret = lcd_8bit_send_command(lcd, (_LCD_CGRAM_START+(mem_pos*8)));
-        for(lcd_counter = 0; lcd_counter <= 7; ++lcd_counter)
-        {
-            ret = lcd_8bit_send_char_data(lcd, _chr[lcd_counter]);
-        }
-        ret = lcd_8bit_send_char_data_pos(lcd, row, column, mem_pos);
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, str);
     }
     return ret;
 }
 
 /*
- * @Brief              : To convert value of 8-Bits to string. 
- * @Param value
- * @Param str
+ * @Brief              : To print a constant string kept in program memory on 8-Bit Character LCD in specific row and column.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param str          : Pointer to the constant string.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str)
+Std_ReturnType lcd_8bit_send_const_string_pos(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, const uint8 *str)
 {
     Std_ReturnType ret = E_OK;
-    if(NULL == str)
+    if((NULL == lcd) || (NULL == str))
     {
         ret = E_NOT_OK;
     }
     else
-    {    
-        memset((char *)str, '\0', 4);
-        sprintf(str, "%i", value);
+    { 
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, row, column);
+        ret = lcd_core_send_string(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, str);
     }
     return ret;
 }
 
 /*
- * @Brief              : To convert value of 16-Bits to string.
- * @Param value
- * @Param str
+ * @Brief              : To print custom character in specific row and column on 8-Bit Character LCD. 
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr
+ * @Param mem_pos      : CGRAM slot, below LCD_CUSTOM_CHAR_SLOTS_NUMBER.
+ * @Note               : With LCD_GLYPH_CACHE_CFG only the LCD_GLYPH_CACHE_RESERVED_SLOTS first slots are 
+ *                       accepted, the other slots belong to the glyph cache.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str)
+Std_ReturnType lcd_8bit_send_custom_char(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, 
+                                         const uint8 _chr[], uint8 mem_pos)
 {
     Std_ReturnType ret = E_OK;
-    uint8 Temp_String[6] = {0};
-    uint8 DataCounter = 0;
-    if(NULL == str)
+    if((NULL == lcd) || (NULL == _chr) || (mem_pos >= LCD_CUSTOM_CHAR_SLOTS_NUMBER))
     {
         ret = E_NOT_OK;
     }
     else
     {    
-        memset(str, ' ', 5);
-        str[5] = '\0';
-        sprintf((char *)Temp_String, "%i", value);
-        while(Temp_String[DataCounter] != '\0')
-        {
-            str[DataCounter] = Temp_String[DataCounter]; 
-            DataCounter++;
-        }
+        ret = lcd_core_send_custom_char(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, row, column, _chr, mem_pos);
     }
     return ret;
 }
-
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph on 8-Bit Character LCD, the glyph is uploaded only if it is not loaded.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code to be sent to print the glyph.
+ * @Note               : After uploading a glyph the cursor has to be set again before printing.
+ *                       A full cache replaces its least recently used slot, every cell still showing 
+ *                       the replaced glyph changes to the new one.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_glyph_cache_get(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                        const uint8 _chr[], uint8 *slot)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == _chr) || (NULL == slot))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_glyph_cache_get(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, cache, _chr, slot);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To print a cached glyph in specific row and column on 8-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr         : The glyph rows.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_send_glyph_pos(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                       uint8 row, uint8 column, const uint8 _chr[])
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot = ZERO_INT;
+    if((NULL == lcd) || (NULL == cache) || (NULL == _chr))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_glyph_cache_get(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, cache, _chr, &l_slot);
+        ret = lcd_core_set_cursor(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, row, column);
+        ret = lcd_write_bus(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, GPIO_HIGH, l_slot);
+    }
+    return ret;
+}
+#endif
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To update a bar graph on 8-Bit Character LCD, only the changed cells are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param value        : Value shown by the bar graph.
+ * @Param full_scale   : Value of the full bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_bar_graph_update(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                         lcd_bar_graph_t *bar, uint16 value, uint16 full_scale)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == bar) || (ZERO_INT == full_scale))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        if(value > full_scale)
+        {
+            value = full_scale;
+        }
+        else{/*****Nothing*****/}
+        ret = lcd_core_bar_graph_update(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, cache, bar, 
+                                        (uint8)(((uint32)value * bar->cells_number * LCD_BAR_GRAPH_CELL_LEVELS) / full_scale));
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To update a big number on 8-Bit Character LCD, only the changed digits are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_big_number_update(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                          lcd_big_number_t *number, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == lcd) || (NULL == cache) || (NULL == number))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        ret = lcd_core_big_number_update(LCD_BUS(lcd), LCD_8BIT_BUS_WIDTH, cache, number, value);
+    }
+    return ret;
+}
+#endif
+#endif
+
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To initialize the Character LCD glyph cache, all CGRAM slots are marked empty.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_glyph_cache_intialize(lcd_glyph_cache_t *cache)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_counter = ZERO_INT;
+    if(NULL == cache)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_slot_counter = ZERO_INT; l_slot_counter < LCD_CGRAM_SLOTS_NUMBER; l_slot_counter++)
+        {
+            cache->slot_glyph[l_slot_counter] = NULL;
+            cache->slot_age[l_slot_counter] = ZERO_INT;
+        }
+        for(l_slot_counter = LCD_GLYPH_CACHE_RESERVED_SLOTS; l_slot_counter < LCD_CGRAM_SLOTS_NUMBER; l_slot_counter++)
+        {
+            /* @Brief : The first cache slot is the oldest one so it is used first, reserved slots are never used. */
+            cache->slot_age[l_slot_counter] = (LCD_CGRAM_SLOTS_NUMBER - 1) - l_slot_counter;
+        }
+    }
+    return ret;
+}
+#endif
+
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To initialize a bar graph, the next update draws all of its cells.
+ * @Param bar          : Pointer to the bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_bar_graph_intialize(lcd_bar_graph_t *bar)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == bar) || (ZERO_INT == bar->cells_number) || 
+       (bar->cells_number >= (LCD_WIDGET_NOT_DRAWN / LCD_BAR_GRAPH_CELL_LEVELS)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        bar->level = LCD_WIDGET_NOT_DRAWN;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To initialize a big number, the next update draws all of its digits.
+ * @Param number       : Pointer to the big number.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_big_number_intialize(lcd_big_number_t *number)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_digit_counter = ZERO_INT;
+    if((NULL == number) || (ZERO_INT == number->digits_number) || (number->digits_number > LCD_BIG_NUMBER_MAX_DIGITS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_digit_counter = ZERO_INT; l_digit_counter < LCD_BIG_NUMBER_MAX_DIGITS; l_digit_counter++)
+        {
+            number->digits[l_digit_counter] = LCD_WIDGET_NOT_DRAWN;
+        }
+    }
+    return ret;
+}
+#endif
+
+/*
+ * @Brief              : To convert value of 8-Bits to string. 
+ * @Param value
+ * @Param str
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType convert_uint8_to_string(uint8 value, uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == str)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        memset((char *)str, '\0', 4);
+        sprintf(str, "%i", value);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To convert value of 16-Bits to string.
+ * @Param value
+ * @Param str
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType convert_uint16_to_string(uint16 value, uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 Temp_String[6] = {0};
+    uint8 DataCounter = 0;
+    if(NULL == str)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {    
+        memset(str, ' ', 5);
+        str[5] = '\0';
+        sprintf((char *)Temp_String, "%i", value);
+        while(Temp_String[DataCounter] != '\0')
+        {
+            str[DataCounter] = Temp_String[DataCounter]; 
+            DataCounter++;
+        }
+    }
+    return ret;
+}
+
 /*
  * @Brief              : To convert value of 32-Bits to string.
  * @Param value
@@ -547,77 +1083,150 @@ Std_ReturnType convert_uint32_to_string(uint32 value, uint8 *str)
 }
 
 /*
- * @Brief              :  Used to send commands for 4-Bits Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
- * @Param _data_command.
+ * @Brief              : To initialize the Character LCD pins and send the initialization commands.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param fast_bus     : Pointer to the fast bus flag of the Character LCD object.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_send_4bits(const chr_4bit_lcd_t *lcd, uint8 _data_command)
+static Std_ReturnType lcd_core_intialize(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 *fast_bus)
 {
     Std_ReturnType ret = E_OK;
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[0]), (_data_command >> 0) & (uint8)0x01);
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[1]), (_data_command >> 1) & (uint8)0x01);
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[2]), (_data_command >> 2) & (uint8)0x01);
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[3]), (_data_command >> 3) & (uint8)0x01);
+    uint8 l_data_pins_counter = ZERO_INT;
+    uint8 l_step_counter = ZERO_INT;
+    uint8 l_delay_counter = ZERO_INT;
+    uint8 l_command = ZERO_INT;
+    ret = gpio_pin_intialize(lcd->lcd_rs); 
+    ret = gpio_pin_intialize(lcd->lcd_en);
+    for(l_data_pins_counter = ZERO_INT; l_data_pins_counter < bus_width; l_data_pins_counter++)
+    {
+        ret = gpio_pin_intialize(&(lcd->lcd_data[l_data_pins_counter]));
+    }
+#if LCD_CONTIGUOUS_BUS_FAST_WRITE==CONFIG_ENABLE
+    /* @Brief : Select the one latch update data bus write for contiguous data pins, kept in each Character LCD object. */
+    *fast_bus = lcd_data_pins_contiguous(lcd->lcd_data, bus_width);
+#else
+    *fast_bus = STD_OFF;
+#endif
+    __delay_ms(20);
+    for(l_step_counter = ZERO_INT; l_step_counter < LCD_INIT_SEQUENCE_LENGTH; l_step_counter++)
+    {
+        l_command = lcd_init_sequence[l_step_counter].command;
+        if((LCD_4BIT_BUS_WIDTH == bus_width) && (LCD_INIT_FUNCTION_SET == l_step_counter))
+        {
+            l_command = _LCD_4BIT_MODE_2_LINE;
+        }
+        else{/*****Nothing*****/}
+        ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, l_command);
+        for(l_delay_counter = lcd_init_sequence[l_step_counter].delay_steps; l_delay_counter > ZERO_INT; l_delay_counter--)
+        {
+            __delay_us(LCD_INIT_DELAY_STEP_US);
+        }
+    }
     return ret;
 }
 
 /*
- * @Brief              : To send enable signal for 4-Bit Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To send command or data byte to the Character LCD, this is the only bus width dependent part.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param rs_logic     : (GPIO_LOW) for command register, (GPIO_HIGH) for data register.
+ * @Param value
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_4bit_send_enable_signal(const chr_4bit_lcd_t *lcd)
+static Std_ReturnType lcd_write_bus(const chr_lcd_bus_t *lcd, uint8 bus_width, logic_t rs_logic, uint8 value)
 {
     Std_ReturnType ret = E_OK;
-    ret = gpio_pin_write_logic(&(lcd->lcd_en), GPIO_HIGH);
-    __delay_us(5);
-    ret = gpio_pin_write_logic(&(lcd->lcd_en), GPIO_LOW);
+    ret = gpio_pin_write_logic(lcd->lcd_rs, rs_logic);
+#if LCD_4BIT_MODE_CFG==CONFIG_ENABLE
+    if(LCD_4BIT_BUS_WIDTH == bus_width)
+    {
+        /* @Brief : High nibble first then low nibble. */
+        ret = lcd_send_data_pins(lcd, bus_width, value >> 4);
+        ret = lcd_send_enable_signal(lcd);
+    }
+    else{/*****Nothing*****/}
+#endif
+    ret = lcd_send_data_pins(lcd, bus_width, value);
+    ret = lcd_send_enable_signal(lcd);
     return ret;
 }
 
 /*
- * @Brief              : To send enable signal for 8-Bit Character LCD.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : Used to put commands or data on the Character LCD data pins.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param _data_command.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_send_data_pins(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 _data_command)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_pin_counter = ZERO_INT;
+#if LCD_CONTIGUOUS_BUS_FAST_WRITE==CONFIG_ENABLE
+    if(STD_ON == *(lcd->lcd_fast_bus))
+    {
+        /* @Brief : One latch update for the whole nibble or byte. */
+        ret = gpio_port_write_logic_masked(lcd->lcd_data[0].port, 
+                                           (uint8)((uint8)(0xFF >> (8 - bus_width)) << lcd->lcd_data[0].pin),
+                                           (uint8)(_data_command << lcd->lcd_data[0].pin));
+    }
+    else
+#endif
+    {
+        for(l_pin_counter = ZERO_INT; l_pin_counter < bus_width; ++l_pin_counter)
+        {
+            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_pin_counter]), (_data_command >> l_pin_counter) & (uint8)0x01);
+        }
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To send enable signal for Character LCD.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_8bit_send_enable_signal(const chr_8bit_lcd_t *lcd)
+static Std_ReturnType lcd_send_enable_signal(const chr_lcd_bus_t *lcd)
 {
     Std_ReturnType ret = E_OK;
-    ret = gpio_pin_write_logic(&(lcd->lcd_en), GPIO_HIGH);
+    ret = gpio_pin_write_logic(lcd->lcd_en, GPIO_HIGH);
     __delay_us(5);
-    ret = gpio_pin_write_logic(&(lcd->lcd_en), GPIO_LOW);
+    ret = gpio_pin_write_logic(lcd->lcd_en, GPIO_LOW);
     return ret;
 }
 
 /*
- * @Brief              : To set cursor of 8-Bit Character LCD in specific column and row.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To set cursor of Character LCD in specific column and row.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_8bit_set_cursor(const chr_8bit_lcd_t *lcd, uint8 row, uint8 coulmn)
+static Std_ReturnType lcd_core_set_cursor(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 row, uint8 coulmn)
 {
     Std_ReturnType ret = E_OK;
     coulmn--;
     switch(row)
-    {    
-        case ROW1 : ret = lcd_8bit_send_command(lcd, (0x80 + coulmn)); break; 
+    {
+        case ROW1 : ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, (0x80 + coulmn)); break;
         
-        case ROW2 : ret = lcd_8bit_send_command(lcd, (0xc0 + coulmn)); break; 
+        case ROW2 : ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, (0xc0 + coulmn)); break;
         
-        case ROW3 : ret = lcd_8bit_send_command(lcd, (0x94 + coulmn)); break; 
+        case ROW3 : ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, (0x94 + coulmn)); break;
         
-        case ROW4 : ret = lcd_8bit_send_command(lcd, (0xd4 + coulmn)); break; 
+        case ROW4 : ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, (0xd4 + coulmn)); break;
         
         default : ;
     }
@@ -625,30 +1234,312 @@ static Std_ReturnType lcd_8bit_set_cursor(const chr_8bit_lcd_t *lcd, uint8 row,
 }
 
 /*
- * @Brief              : To set cursor of 4-Bit Character LCD in specific column and row.
- * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Brief              : To print a string on Character LCD.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param str
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_send_string(const chr_lcd_bus_t *lcd, uint8 bus_width, const uint8 *str)
+{
+    Std_ReturnType ret = E_OK;
+    while(*str)
+    {
+        ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, *str++);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To print custom character in specific row and column on Character LCD. 
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr
+ * @Param mem_pos
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-static Std_ReturnType lcd_4bit_set_cursor(const chr_4bit_lcd_t *lcd, uint8 row, uint8 coulmn)
+static Std_ReturnType lcd_core_send_custom_char(const chr_lcd_bus_t *lcd, uint8 bus_width, uint8 row, uint8 column, 
+                                                const uint8 _chr[], uint8 mem_pos)
 {
     Std_ReturnType ret = E_OK;
-    coulmn--;
-    switch(row)
+    ret = lcd_core_upload_glyph(lcd, bus_width, _chr, mem_pos);
+    ret = lcd_core_set_cursor(lcd, bus_width, row, column);
+    ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, mem_pos);
+    return ret;
+}
+
+/*
+ * @Brief              : To upload the rows of a custom character to one CGRAM slot.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param _chr
+ * @Param mem_pos      : CGRAM slot of the custom character.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_upload_glyph(const chr_lcd_bus_t *lcd, uint8 bus_width, const uint8 _chr[], uint8 mem_pos)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 lcd_counter = ZERO_INT;
+    ret = lcd_write_bus(lcd, bus_width, GPIO_LOW, (_LCD_CGRAM_START+(mem_pos*LCD_GLYPH_ROWS_NUMBER)));
+    for(lcd_counter = ZERO_INT; lcd_counter < LCD_GLYPH_ROWS_NUMBER; ++lcd_counter)
     {
-        case ROW1 : ret = lcd_4bit_send_command(lcd, (0x80 + coulmn)); break;
-        
-        case ROW2 : ret = lcd_4bit_send_command(lcd, (0xc0 + coulmn)); break;
-        
-        case ROW3 : ret = lcd_4bit_send_command(lcd, (0x94 + coulmn)); break;
-        
-        case ROW4 : ret = lcd_4bit_send_command(lcd, (0xd4 + coulmn));  break;
-        
-        default : ;
+        ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, _chr[lcd_counter]);
     }
     return ret;
 }
+
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph, on a miss the least recently used slot is replaced.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code of the glyph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_glyph_cache_get(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                               const uint8 _chr[], uint8 *slot)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_counter = ZERO_INT;
+    uint8 l_slot = LCD_CGRAM_SLOTS_NUMBER;
+    uint8 l_oldest_slot = LCD_GLYPH_CACHE_RESERVED_SLOTS;
+    for(l_slot_counter = LCD_GLYPH_CACHE_RESERVED_SLOTS; l_slot_counter < LCD_CGRAM_SLOTS_NUMBER; l_slot_counter++)
+    {
+        if(_chr == cache->slot_glyph[l_slot_counter])
+        {
+            l_slot = l_slot_counter;
+        }
+        else if((LCD_GLYPH_CACHE_SLOTS_NUMBER - 1) == cache->slot_age[l_slot_counter])
+        {
+            l_oldest_slot = l_slot_counter;
+        }
+        else{/*****Nothing*****/}
+    }
+    if(LCD_CGRAM_SLOTS_NUMBER == l_slot)
+    {
+        /* @Brief : Cache miss, replace the least recently used slot. */
+        l_slot = l_oldest_slot;
+        ret = lcd_core_upload_glyph(lcd, bus_width, _chr, l_slot);
+        cache->slot_glyph[l_slot] = _chr;
+    }
+    else{/*****Nothing*****/}
+    /* @Brief : Make the slot the most recently used one, the younger slots get older by one. */
+    for(l_slot_counter = LCD_GLYPH_CACHE_RESERVED_SLOTS; l_slot_counter < LCD_CGRAM_SLOTS_NUMBER; l_slot_counter++)
+    {
+        if(cache->slot_age[l_slot_counter] < cache->slot_age[l_slot])
+        {
+            cache->slot_age[l_slot_counter]++;
+        }
+        else{/*****Nothing*****/}
+    }
+    cache->slot_age[l_slot] = ZERO_INT;
+    *slot = l_slot;
+    return ret;
+}
+#endif
+
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To draw the cells of a bar graph changed since the last update.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param level        : Bar graph level, LCD_BAR_GRAPH_CELL_LEVELS for each cell.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_bar_graph_update(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                                lcd_bar_graph_t *bar, uint8 level)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_first_cell = ZERO_INT;
+    uint8 l_last_cell = ZERO_INT;
+    uint8 l_cell_counter = ZERO_INT;
+    uint8 l_partial_cell = level / LCD_BAR_GRAPH_CELL_LEVELS;
+    uint8 l_partial_columns = level % LCD_BAR_GRAPH_CELL_LEVELS;
+    uint8 l_partial_slot = LCD_BIG_CELL_SPACE;
+    if(LCD_WIDGET_NOT_DRAWN == bar->level)
+    {
+        l_first_cell = ZERO_INT;
+        l_last_cell = bar->cells_number - 1;
+    }
+    else if(level != bar->level)
+    {
+        /* @Brief : Only the cells between the old and the new level end are changed. */
+        if(level < bar->level)
+        {
+            l_first_cell = level / LCD_BAR_GRAPH_CELL_LEVELS;
+            l_last_cell = bar->level / LCD_BAR_GRAPH_CELL_LEVELS;
+        }
+        else
+        {
+            l_first_cell = bar->level / LCD_BAR_GRAPH_CELL_LEVELS;
+            l_last_cell = level / LCD_BAR_GRAPH_CELL_LEVELS;
+        }
+        if(l_last_cell >= bar->cells_number)
+        {
+            l_last_cell = bar->cells_number - 1;
+        }
+        else{/*****Nothing*****/}
+    }
+    else
+    {
+        /* @Brief : Nothing changed, nothing to send. */
+        l_first_cell = 1;
+        l_last_cell = ZERO_INT;
+    }
+    if(l_first_cell <= l_last_cell)
+    {
+        /* @Brief : The glyph is taken before setting the cursor as an upload moves the address to CGRAM. */
+        if(ZERO_INT != l_partial_columns)
+        {
+            ret = lcd_core_glyph_cache_get(lcd, bus_width, cache, lcd_bar_graph_glyphs[l_partial_columns - 1], &l_partial_slot);
+        }
+        else{/*****Nothing*****/}
+        ret = lcd_core_set_cursor(lcd, bus_width, bar->row, bar->column + l_first_cell);
+        for(l_cell_counter = l_first_cell; l_cell_counter <= l_last_cell; l_cell_counter++)
+        {
+            if(l_cell_counter < l_partial_cell)
+            {
+                ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, LCD_BIG_CELL_FULL);
+            }
+            else if(l_cell_counter == l_partial_cell)
+            {
+                ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, l_partial_slot);
+            }
+            else
+            {
+                ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, LCD_BIG_CELL_SPACE);
+            }
+        }
+        bar->level = level;
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+
+/*
+ * @Brief              : To draw the digits of a big number changed since the last update.
+ * @Param lcd          : Pointer to the Character LCD common bus view.
+ * @Param bus_width    : Character LCD data bus width (4 or 8).
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+static Std_ReturnType lcd_core_big_number_update(const chr_lcd_bus_t *lcd, uint8 bus_width, lcd_glyph_cache_t *cache, 
+                                                 lcd_big_number_t *number, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_digits[LCD_BIG_NUMBER_MAX_DIGITS];
+    uint8 l_glyph_slots[LCD_BIG_GLYPHS_NUMBER];
+    uint8 l_digit_counter = ZERO_INT;
+    uint8 l_cell_counter = ZERO_INT;
+    uint8 l_changed = STD_OFF;
+    const uint8 *l_font = NULL;
+    for(l_digit_counter = number->digits_number; l_digit_counter > ZERO_INT; l_digit_counter--)
+    {
+        l_digits[l_digit_counter - 1] = (uint8)(value % 10);
+        value /= 10;
+    }
+    /* @Brief : Leading zeros are blanked, the last digit is always shown. */
+    for(l_digit_counter = ZERO_INT; (l_digit_counter < (number->digits_number - 1)) && (ZERO_INT == l_digits[l_digit_counter]); l_digit_counter++)
+    {
+        l_digits[l_digit_counter] = LCD_BIG_DIGIT_BLANK;
+    }
+    for(l_digit_counter = ZERO_INT; l_digit_counter < number->digits_number; l_digit_counter++)
+    {
+        if(l_digits[l_digit_counter] != number->digits[l_digit_counter])
+        {
+            l_changed = STD_ON;
+        }
+        else{/*****Nothing*****/}
+    }
+    if(STD_ON == l_changed)
+    {
+        /* @Brief : The glyphs are taken before setting the cursor as an upload moves the address to CGRAM. */
+        for(l_cell_counter = ZERO_INT; l_cell_counter < LCD_BIG_GLYPHS_NUMBER; l_cell_counter++)
+        {
+            ret = lcd_core_glyph_cache_get(lcd, bus_width, cache, lcd_big_number_glyphs[l_cell_counter], &l_glyph_slots[l_cell_counter]);
+        }
+        for(l_digit_counter = ZERO_INT; l_digit_counter < number->digits_number; l_digit_counter++)
+        {
+            if(l_digits[l_digit_counter] != number->digits[l_digit_counter])
+            {
+                l_font = lcd_big_number_font[l_digits[l_digit_counter]];
+                for(l_cell_counter = ZERO_INT; l_cell_counter < (2 * LCD_BIG_DIGIT_WIDTH); l_cell_counter++)
+                {
+                    if(ZERO_INT == (l_cell_counter % LCD_BIG_DIGIT_WIDTH))
+                    {
+                        ret = lcd_core_set_cursor(lcd, bus_width, number->row + (l_cell_counter / LCD_BIG_DIGIT_WIDTH), 
+                                                  number->column + (l_digit_counter * LCD_BIG_DIGIT_WIDTH));
+                    }
+                    else{/*****Nothing*****/}
+                    if(l_font[l_cell_counter] < LCD_BIG_GLYPHS_NUMBER)
+                    {
+                        ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, l_glyph_slots[l_font[l_cell_counter]]);
+                    }
+                    else
+                    {
+                        ret = lcd_write_bus(lcd, bus_width, GPIO_HIGH, l_font[l_cell_counter]);
+                    }
+                }
+                number->digits[l_digit_counter] = l_digits[l_digit_counter];
+            }
+            else{/*****Nothing*****/}
+        }
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+#endif
+
+#if LCD_CONTIGUOUS_BUS_FAST_WRITE==CONFIG_ENABLE
+/*
+ * @Brief               : To check if the Character LCD data pins are contiguous bits of one port.
+ * @Param _data_pins    : The Character LCD data pins configurations, least significant bit first.
+ * @Param _pins_number  : Number of the data pins (4 or 8).
+ * @Return Status of the data pins.
+ *          (STD_ON)    : The data pins are contiguous on one port.
+ *          (STD_OFF)   : The data pins have to be written one by one.
+ */
+static uint8 lcd_data_pins_contiguous(const pin_config_t _data_pins[], uint8 _pins_number)
+{
+    uint8 l_contiguous = STD_ON;
+    uint8 l_pin_counter = ZERO_INT;
+    if((_data_pins[0].pin + _pins_number) > PORT_PIN_MAX_NUMBER)
+    {
+        l_contiguous = STD_OFF;
+    }
+    else
+    {
+        for(l_pin_counter = 1; l_pin_counter < _pins_number; l_pin_counter++)
+        {
+            if((_data_pins[l_pin_counter].port != _data_pins[0].port) ||
+               (_data_pins[l_pin_counter].pin != (_data_pins[0].pin + l_pin_counter)))
+            {
+                l_contiguous = STD_OFF;
+            }
+            else{/*****Nothing*****/}
+        }
+    }
+    return l_contiguous;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
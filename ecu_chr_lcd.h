@@ -60,10 +60,40 @@
 #define ROW2 2
 #define ROW3 3
 #define ROW4 4
+
+/* @Brief : Macro for Character LCD number of CGRAM custom character slots. */
+#define LCD_CGRAM_SLOTS_NUMBER          8
+/* @Brief : Macros for Character LCD CGRAM slots of the custom characters and of the glyph cache. */
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+#define LCD_CUSTOM_CHAR_SLOTS_NUMBER    LCD_GLYPH_CACHE_RESERVED_SLOTS
+#define LCD_GLYPH_CACHE_SLOTS_NUMBER    (LCD_CGRAM_SLOTS_NUMBER - LCD_GLYPH_CACHE_RESERVED_SLOTS)
+#else
+#define LCD_CUSTOM_CHAR_SLOTS_NUMBER    LCD_CGRAM_SLOTS_NUMBER
+#endif
+/* @Brief : Macro for Character LCD number of rows of one custom character. */
+#define LCD_GLYPH_ROWS_NUMBER           8
+
+/* @Brief : Macro for Character LCD bar graph number of levels in one cell (one level for each pixel column). */
+#define LCD_BAR_GRAPH_CELL_LEVELS       5
+/* @Brief : Macro for Character LCD big number maximum number of digits. */
+#define LCD_BIG_NUMBER_MAX_DIGITS       5
+/* @Brief : Macro for Character LCD big number digit width in cells. */
+#define LCD_BIG_DIGIT_WIDTH             3
+/* @Brief : Macro for Character LCD widget state before the first update. */
+#define LCD_WIDGET_NOT_DRAWN            0xFF
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
-
+/* @Brief : Checked after hal_gpio.h, CONFIG_ENABLE is not defined yet in ecu_chr_lcd_cfg.h. */
+#if (LCD_WIDGETS_CFG==CONFIG_ENABLE) && (LCD_GLYPH_CACHE_CFG!=CONFIG_ENABLE)
+#error "LCD_WIDGETS_CFG needs LCD_GLYPH_CACHE_CFG enabled."
+#endif
+#if (LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE) && (LCD_GLYPH_CACHE_RESERVED_SLOTS >= LCD_CGRAM_SLOTS_NUMBER)
+#error "LCD_GLYPH_CACHE_RESERVED_SLOTS leaves no CGRAM slot to the glyph cache."
+#endif
+#if (LCD_WIDGETS_CFG==CONFIG_ENABLE) && (LCD_GLYPH_CACHE_RESERVED_SLOTS > (LCD_CGRAM_SLOTS_NUMBER - 4))
+#error "LCD_WIDGETS_CFG needs 4 glyph cache slots, lower LCD_GLYPH_CACHE_RESERVED_SLOTS."
+#endif
 /***********************************************************************/
 
 /********************Data Types Declarations-Section********************/
@@ -73,6 +103,7 @@ typedef struct
     pin_config_t lcd_rs;        /* @Brief : 4-Bit Character LCD rs pin configuration. */
     pin_config_t lcd_en;        /* @Brief : 4-Bit Character LCD en pin configuration. */
     pin_config_t lcd_data[4];   /* @Brief : 4-Bit Character LCD data configuration. */
+    uint8 lcd_fast_bus;         /* @Brief : Set by lcd_4bit_intialize, STD_ON when the data pins are contiguous on one port. */
 }chr_4bit_lcd_t;
 
 /* @Brief : 8-Bit Character LCD configuration. */
@@ -81,10 +112,44 @@ typedef struct
     pin_config_t lcd_rs;         /* @Brief : 8-Bit Character LCD rs pin configuration. */
     pin_config_t lcd_en;         /* @Brief : 8-Bit Character LCD en pin configuration. */  
     pin_config_t lcd_data[8];    /* @Brief : 8-Bit Character LCD data configuration. */
+    uint8 lcd_fast_bus;          /* @Brief : Set by lcd_8bit_intialize, STD_ON when the data pins are contiguous on one port. */
 }chr_8bit_lcd_t;
+
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/* 
+ * @Brief : Character LCD CGRAM glyph cache, one object for each Character LCD.
+ * @Note  : Glyphs are identified by their address, so keep them as const tables in program memory.
+ */
+typedef struct
+{
+    const uint8 *slot_glyph[LCD_CGRAM_SLOTS_NUMBER];    /* @Brief : Glyph loaded in each CGRAM slot, NULL for empty slot. */
+    uint8 slot_age[LCD_CGRAM_SLOTS_NUMBER];             /* @Brief : Slot use order, 0 for most recently used slot and for reserved slots. */
+}lcd_glyph_cache_t;
+#endif
+
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/* @Brief : Character LCD horizontal bar graph widget. */
+typedef struct
+{
+    uint8 row;              /* @Brief : Bar graph row. */
+    uint8 column;           /* @Brief : Bar graph first column. */
+    uint8 cells_number;     /* @Brief : Bar graph length in cells. */
+    uint8 level;            /* @Brief : Level shown on the Character LCD, @Ref : LCD_WIDGET_NOT_DRAWN. */
+}lcd_bar_graph_t;
+
+/* @Brief : Character LCD big number widget, every digit takes 3 columns of 2 rows. */
+typedef struct
+{
+    uint8 row;                                  /* @Brief : Big number upper row. */
+    uint8 column;                               /* @Brief : Big number first column. */
+    uint8 digits_number;                        /* @Brief : Big number number of digits. */
+    uint8 digits[LCD_BIG_NUMBER_MAX_DIGITS];    /* @Brief : Digits shown on the Character LCD, @Ref : LCD_WIDGET_NOT_DRAWN. */
+}lcd_big_number_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
+#if LCD_4BIT_MODE_CFG==CONFIG_ENABLE
 /* 
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the 4-Bit Character LCD OFF or ON.
  * @Param lcd          : Pointer to the Character LCD module configurations.
@@ -92,7 +157,7 @@ typedef struct
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType lcd_4bit_intialize(const chr_4bit_lcd_t *lcd);
+Std_ReturnType lcd_4bit_intialize(chr_4bit_lcd_t *lcd);
 
 /* 
  * @Brief              : To send commands to 4-Bit Character LCD command register.
@@ -149,20 +214,105 @@ Std_ReturnType lcd_4bit_send_string(const chr_4bit_lcd_t *lcd, uint8 *str);
  */
 Std_ReturnType lcd_4bit_send_string_pos(const chr_4bit_lcd_t *lcd, uint8 row, uint8 column, uint8 *str);
 
+/*
+ * @Brief              : To print a constant string kept in program memory on 4-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD configurations.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_const_string(const chr_4bit_lcd_t *lcd, const uint8 *str);
+
+/*
+ * @Brief              : To print a constant string kept in program memory on 4-Bit Character LCD in specific row and column.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_const_string_pos(const chr_4bit_lcd_t *lcd, uint8 row, uint8 column, const uint8 *str);
+
 /*
  * @Brief              : To print custom character in specific row and column on 4-Bit Character LCD. 
  * @Param lcd          : Pointer to the Character LCD module configurations.
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
  * @Param _chr
- * @Param mem_pos
+ * @Param mem_pos      : CGRAM slot, below LCD_CUSTOM_CHAR_SLOTS_NUMBER.
+ * @Note               : With LCD_GLYPH_CACHE_CFG only the LCD_GLYPH_CACHE_RESERVED_SLOTS first slots are 
+ *                       accepted, the other slots belong to the glyph cache.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
 Std_ReturnType lcd_4bit_send_custom_char(const chr_4bit_lcd_t *lcd, uint8 row, uint8 column, 
                                          const uint8 _chr[], uint8 mem_pos);
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph on 4-Bit Character LCD, the glyph is uploaded only if it is not loaded.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code to be sent to print the glyph.
+ * @Note               : After uploading a glyph the cursor has to be set again before printing.
+ *                       A full cache replaces its least recently used slot, every cell still showing 
+ *                       the replaced glyph changes to the new one.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_glyph_cache_get(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                        const uint8 _chr[], uint8 *slot);
+
+/*
+ * @Brief              : To print a cached glyph in specific row and column on 4-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr         : The glyph rows.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_send_glyph_pos(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                       uint8 row, uint8 column, const uint8 _chr[]);
+#endif
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To update a bar graph on 4-Bit Character LCD, only the changed cells are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param value        : Value shown by the bar graph.
+ * @Param full_scale   : Value of the full bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_bar_graph_update(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                         lcd_bar_graph_t *bar, uint16 value, uint16 full_scale);
 
+/*
+ * @Brief              : To update a big number on 4-Bit Character LCD, only the changed digits are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_4bit_big_number_update(const chr_4bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                          lcd_big_number_t *number, uint16 value);
+#endif
+#endif
+
+#if LCD_8BIT_MODE_CFG==CONFIG_ENABLE
 /* 
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the 8-Bit Character LCD OFF or ON.
  * @Param lcd          : Pointer to the Character LCD module configurations.
@@ -170,7 +320,7 @@ Std_ReturnType lcd_4bit_send_custom_char(const chr_4bit_lcd_t *lcd, uint8 row, u
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
-Std_ReturnType lcd_8bit_intialize(const chr_8bit_lcd_t *lcd);
+Std_ReturnType lcd_8bit_intialize(chr_8bit_lcd_t *lcd);
 
 /* 
  * @Brief              : To send commands to 8-Bit Character LCD command register.
@@ -226,18 +376,133 @@ Std_ReturnType lcd_8bit_send_string(const chr_8bit_lcd_t *lcd, uint8 *str);
  */
 Std_ReturnType lcd_8bit_send_string_pos(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, uint8 *str);
 
+/*
+ * @Brief              : To print a constant string kept in program memory on 8-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD configurations.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_send_const_string(const chr_8bit_lcd_t *lcd, const uint8 *str);
+
+/*
+ * @Brief              : To print a constant string kept in program memory on 8-Bit Character LCD in specific row and column.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param str          : Pointer to the constant string.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_send_const_string_pos(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, const uint8 *str);
+
 /*
  * @Brief              : To print custom character in specific row and column on 8-Bit Character LCD. 
  * @Param lcd          : Pointer to the Character LCD module configurations.
  * @Param row          : To select which row you need to print your character.
  * @Param coulmn       : To select which column you need to print your character.
  * @Param _chr
- * @Param mem_pos
+ * @Param mem_pos      : CGRAM slot, below LCD_CUSTOM_CHAR_SLOTS_NUMBER.
+ * @Note               : With LCD_GLYPH_CACHE_CFG only the LCD_GLYPH_CACHE_RESERVED_SLOTS first slots are 
+ *                       accepted, the other slots belong to the glyph cache.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
 Std_ReturnType lcd_8bit_send_custom_char(const chr_8bit_lcd_t *lcd, uint8 row, uint8 column, const uint8 _chr[], uint8 mem_pos);
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To get the CGRAM slot of a glyph on 8-Bit Character LCD, the glyph is uploaded only if it is not loaded.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param _chr         : The glyph rows.
+ * @Param slot         : Pointer to the character code to be sent to print the glyph.
+ * @Note               : After uploading a glyph the cursor has to be set again before printing.
+ *                       A full cache replaces its least recently used slot, every cell still showing 
+ *                       the replaced glyph changes to the new one.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_glyph_cache_get(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                        const uint8 _chr[], uint8 *slot);
+
+/*
+ * @Brief              : To print a cached glyph in specific row and column on 8-Bit Character LCD.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param row          : To select which row you need to print your character.
+ * @Param coulmn       : To select which column you need to print your character.
+ * @Param _chr         : The glyph rows.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_send_glyph_pos(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                       uint8 row, uint8 column, const uint8 _chr[]);
+#endif
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To update a bar graph on 8-Bit Character LCD, only the changed cells are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param bar          : Pointer to the bar graph.
+ * @Param value        : Value shown by the bar graph.
+ * @Param full_scale   : Value of the full bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_bar_graph_update(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                         lcd_bar_graph_t *bar, uint16 value, uint16 full_scale);
+
+/*
+ * @Brief              : To update a big number on 8-Bit Character LCD, only the changed digits are sent.
+ * @Param lcd          : Pointer to the Character LCD module configurations.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Param number       : Pointer to the big number.
+ * @Param value
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_8bit_big_number_update(const chr_8bit_lcd_t *lcd, lcd_glyph_cache_t *cache, 
+                                          lcd_big_number_t *number, uint16 value);
+#endif
+#endif
+
+#if LCD_GLYPH_CACHE_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To initialize the Character LCD glyph cache, all CGRAM slots are marked empty.
+ * @Param cache        : Pointer to the Character LCD glyph cache.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_glyph_cache_intialize(lcd_glyph_cache_t *cache);
+#endif
+
+#if LCD_WIDGETS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To initialize a bar graph, the next update draws all of its cells.
+ * @Param bar          : Pointer to the bar graph.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_bar_graph_intialize(lcd_bar_graph_t *bar);
+
+/*
+ * @Brief              : To initialize a big number, the next update draws all of its digits.
+ * @Param number       : Pointer to the big number.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType lcd_big_number_intialize(lcd_big_number_t *number);
+#endif
 
 /*
  * @Brief              : To convert value of 8-Bits to string. 
@@ -14,7 +14,37 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macros to enable the 4-Bit and 8-Bit Character LCD interfaces.
+ * @Note  : Both interfaces share one driver core, disable the unused one to remove its bus writer.
+ */
+#define LCD_4BIT_MODE_CFG               CONFIG_ENABLE
+#define LCD_8BIT_MODE_CFG               CONFIG_ENABLE
+
+/* 
+ * @Brief : Macro to enable the CGRAM glyph cache for Character LCD custom characters.
+ * @Note  : The cache keeps which glyph is loaded in each CGRAM slot and uploads a glyph 
+ *          only when it is not loaded, the least recently used slot is replaced.
+ */
+#define LCD_GLYPH_CACHE_CFG             CONFIG_ENABLE
+/* 
+ * @Brief : Macro for the first CGRAM slots kept for lcd_4bit_send_custom_char and lcd_8bit_send_custom_char.
+ * @Note  : The glyph cache uses the other slots, with the widgets it needs 4 of them (big number and bar graph).
+ */
+#define LCD_GLYPH_CACHE_RESERVED_SLOTS  1
+
+/* 
+ * @Brief : Macro to enable the Character LCD bar graph and big number widgets.
+ * @Note  : The widgets use the glyph cache and redraw only the cells changed since the last update.
+ */
+#define LCD_WIDGETS_CFG                 CONFIG_ENABLE
 
+/* 
+ * @Brief : Macro to enable the fast data bus write for Character LCD.
+ * @Note  : When the data pins are contiguous bits of one port the nibble or byte is written
+ *          with one latch update, otherwise the driver writes the data pins one by one.
+ */
+#define LCD_CONTIGUOUS_BUS_FAST_WRITE   CONFIG_ENABLE
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
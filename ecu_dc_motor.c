@@ -10,6 +10,40 @@
 #include "ecu_dc_motor.h"
 /***********************************************************************/
 
+/*****************Helper Functions Declarations-Section*****************/
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the PWM duty of the speed PID output at full scale. */
+#define DC_MOTOR_SPEED_DUTY_MAX          ((sint32)CCP_PWM_DUTY_PERMILLE_FULL_SCALE)
+/* @Brief : Macro for the largest measured speed. */
+#define DC_MOTOR_SPEED_RPM_MAX           ((uint32)0xFFFF)
+/* 
+ * @Brief : Macro for the largest speed error and speed change taken by the PID. Each gain product stays
+ *          below 2^29 so the PID sum cannot overflow 32-Bit, and any gain from 16 (1/16 per-mille per RPM)
+ *          already saturates the output at this error.
+ */
+#define DC_MOTOR_SPEED_ERROR_LIMIT       ((sint32)0x3FFF)
+
+/*
+ * @Brief              : To run the speed PID with anti-windup for one loop.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param measured_rpm : Speed measured in this loop run.
+ * @Return PWM duty in per-mille.
+ */
+static uint16 dc_motor_speed_pid(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state, uint16 measured_rpm);
+#endif
+
+#if DC_MOTOR_RAMP_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the fraction bits of the ramp duty values. */
+#define DC_MOTOR_RAMP_DUTY_SHIFT         16
+
+/* @Brief : S-curve ramp phases. */
+#define DC_MOTOR_RAMP_PHASE_ACCEL        0
+#define DC_MOTOR_RAMP_PHASE_CRUISE       1
+#define DC_MOTOR_RAMP_PHASE_DECEL        2
+#endif
+/***********************************************************************/
+
 /*****************Software Interfaces Functions-Section*****************/
 /*
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the DC Motor OFF or ON.
@@ -25,6 +59,13 @@ Std_ReturnType dc_motor_initialize(const dc_motor_t *_dc_motor)
     {
         ret = E_NOT_OK;
     }
+#if DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE
+    else if(NULL != _dc_motor->dc_motor_bridge)
+    {
+        /* @Brief : The ECCP1 bridge pins are initialized with the CCP module, the DC Motor starts stopped. */
+        ret = CCP_Set_PWM_Duty_Raw(_dc_motor->dc_motor_bridge, ZERO_INT);
+    }
+#endif
     else
     {
         gpio_pin_intialize(&(_dc_motor->dc_motor_pin[DC_MOTOR_PIN1]));  /* @Brief : To initialize DC Motor pin1. */
@@ -36,6 +77,7 @@ Std_ReturnType dc_motor_initialize(const dc_motor_t *_dc_motor)
 /*
  * @Brief              : To make the DC Motor move right.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge forward, the speed is the CCP PWM duty.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
@@ -47,6 +89,12 @@ Std_ReturnType dc_motor_move_right(const dc_motor_t *_dc_motor)
     {
         ret = E_NOT_OK;
     }
+#if DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE
+    else if(NULL != _dc_motor->dc_motor_bridge)
+    {
+        ret = CCP_ECCP_Set_Bridge_Direction(_dc_motor->dc_motor_bridge, CCP_ECCP_FULL_BRIDGE_FORWARD);
+    }
+#endif
     else
     {
         gpio_pin_write_logic(&(_dc_motor->dc_motor_pin[DC_MOTOR_PIN1]), GPIO_HIGH);  /* @Brief : To write logic high on DC Motor pin1. */
@@ -58,6 +106,7 @@ Std_ReturnType dc_motor_move_right(const dc_motor_t *_dc_motor)
 /*
  * @Brief              : To make the DC Motor move left.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge reverse, the speed is the CCP PWM duty.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
@@ -69,6 +118,12 @@ Std_ReturnType dc_motor_move_left(const dc_motor_t *_dc_motor)
     {
         ret = E_NOT_OK;
     }
+#if DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE
+    else if(NULL != _dc_motor->dc_motor_bridge)
+    {
+        ret = CCP_ECCP_Set_Bridge_Direction(_dc_motor->dc_motor_bridge, CCP_ECCP_FULL_BRIDGE_REVERSE);
+    }
+#endif
     else
     {
         gpio_pin_write_logic(&(_dc_motor->dc_motor_pin[DC_MOTOR_PIN1]), GPIO_LOW);    /* @Brief : To write logic low on DC Motor pin1. */ 
@@ -80,6 +135,7 @@ Std_ReturnType dc_motor_move_left(const dc_motor_t *_dc_motor)
 /*
  * @Brief              : To stop the DC Motor.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge PWM duty to 0, it has to be set again after the next move.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
@@ -91,6 +147,12 @@ Std_ReturnType dc_motor_stop(const dc_motor_t *_dc_motor)
     {
         ret = E_NOT_OK;
     }
+#if DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE
+    else if(NULL != _dc_motor->dc_motor_bridge)
+    {
+        ret = CCP_Set_PWM_Duty_Raw(_dc_motor->dc_motor_bridge, ZERO_INT);
+    }
+#endif
     else
     {
         gpio_pin_write_logic(&(_dc_motor->dc_motor_pin[DC_MOTOR_PIN1]), GPIO_LOW);  /* @Brief : To write logic low on DC Motor pin1. */
@@ -98,4 +160,501 @@ Std_ReturnType dc_motor_stop(const dc_motor_t *_dc_motor)
     }
     return ret;
 }
+
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the DC Motor pins and its speed control state with the PWM duty at 0.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Note               : The CCP, Timer1 and Timer3 modules are initialized by the application.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or one encoder pulse
+ *                       per loop is below 1/256 RPM.
+ */
+Std_ReturnType dc_motor_speed_initialize(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _speed) || (NULL == _state) || (NULL == _speed->dc_motor) || (NULL == _speed->motor_pwm) || 
+       (NULL == _speed->encoder_counter) || (ZERO_INT == _speed->encoder_pulses_per_rev) || 
+       (ZERO_INT == _speed->loop_frequency))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->target_rpm = ZERO_INT;
+        _state->measured_rpm = ZERO_INT;
+        _state->duty_permille = ZERO_INT;
+        _state->last_start = ZERO_INT;
+        _state->integral = ZERO_INT;
+        /* @Brief : The only division of the speed control, the loop turns pulses into RPM with one multiply. */
+        _state->rpm_per_pulse = (((uint32)60 * _speed->loop_frequency) << DC_MOTOR_SPEED_Q_SHIFT) / 
+                                _speed->encoder_pulses_per_rev;
+        /* 
+         * @Brief : Pulses per loop from which the speed reads DC_MOTOR_SPEED_RPM_MAX, fewer pulses
+         *          times rpm_per_pulse stay below 2^24 + rpm_per_pulse, far from 32-Bit overflow.
+         */
+        _state->pulses_limit = ZERO_INT;
+        if(ZERO_INT != _state->rpm_per_pulse)
+        {
+            _state->pulses_limit = (((DC_MOTOR_SPEED_RPM_MAX + 1) << DC_MOTOR_SPEED_Q_SHIFT) + 
+                                    _state->rpm_per_pulse - 1) / _state->rpm_per_pulse;
+        }
+        else{/*****Nothing*****/}
+        _state->stats.loop_runs = ZERO_INT;
+        _state->stats.last_exec_ticks = ZERO_INT;
+        _state->stats.max_exec_ticks = ZERO_INT;
+        _state->stats.min_period_ticks = 0xFFFF;
+        _state->stats.max_period_ticks = ZERO_INT;
+        ret = dc_motor_initialize(_speed->dc_motor);
+        ret = Timer1_Read_Value(_speed->encoder_counter, &(_state->last_count));
+        ret = CCP_Set_PWM_Duty_Permille(_speed->motor_pwm, ZERO_INT);
+        /* @Brief : One pulse per loop under 1 RPM in Q8, the encoder cannot measure the speed. */
+        if(ZERO_INT == _state->rpm_per_pulse)
+        {
+            ret = E_NOT_OK;
+        }
+        else{/*****Nothing*****/}
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To set the DC Motor target speed.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param target_rpm   : Target speed in RPM, 0 stops the PWM.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_set_target(dc_motor_speed_state_t *_state, uint16 target_rpm)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->target_rpm = target_rpm;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read the DC Motor speed measured at the last loop run.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param measured_rpm : Pointer to the measured speed in RPM.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_get_measured(dc_motor_speed_state_t *_state, uint16 *measured_rpm)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _state) || (NULL == measured_rpm))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : Read again if the speed loop interrupt updated the value between the two bytes. */
+        do
+        {
+            *measured_rpm = _state->measured_rpm;
+        }while(*measured_rpm != _state->measured_rpm);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read a coherent copy of the DC Motor speed loop timing statistics.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param stats        : Pointer to the copy of the loop timing statistics.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_get_stats(dc_motor_speed_state_t *_state, dc_motor_loop_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _state) || (NULL == stats))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : Copy again if a loop run completed during the copy. */
+        do
+        {
+            *stats = _state->stats;
+        }while(stats->loop_runs != _state->stats.loop_runs);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To measure the speed and run the speed PID, called from a periodic timer interrupt.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_task(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_start = ZERO_INT;
+    uint16 l_end = ZERO_INT;
+    uint16 l_count = ZERO_INT;
+    uint16 l_ticks = ZERO_INT;
+    uint16 l_measured_rpm = ZERO_INT;
+    uint16 l_pulses = ZERO_INT;
+    uint32 l_rpm = ZERO_INT;
+    if((NULL == _speed) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(NULL != _speed->loop_timebase)
+        {
+            ret = Timer3_Read_Value(_speed->loop_timebase, &l_start);
+        }
+        else{/*****Nothing*****/}
+        
+        /* @Brief : Speed from the encoder pulses counted since the last run, wrap-safe 16-Bit difference. */
+        ret = Timer1_Read_Value(_speed->encoder_counter, &l_count);
+        l_pulses = (uint16)(l_count - _state->last_count);
+        _state->last_count = l_count;
+        if(l_pulses >= _state->pulses_limit)
+        {
+            /* @Brief : Saturated before the multiply, the product would overflow 32-Bit. */
+            l_measured_rpm = (uint16)DC_MOTOR_SPEED_RPM_MAX;
+        }
+        else
+        {
+            l_rpm = ((uint32)l_pulses * _state->rpm_per_pulse) >> DC_MOTOR_SPEED_Q_SHIFT;
+            l_measured_rpm = (l_rpm > DC_MOTOR_SPEED_RPM_MAX) ? (uint16)DC_MOTOR_SPEED_RPM_MAX : (uint16)l_rpm;
+        }
+        
+        _state->duty_permille = dc_motor_speed_pid(_speed, _state, l_measured_rpm);
+        _state->measured_rpm = l_measured_rpm;
+        ret = CCP_Set_PWM_Duty_Permille(_speed->motor_pwm, _state->duty_permille);
+        
+        /* @Brief : Loop timing statistics. */
+        if(NULL != _speed->loop_timebase)
+        {
+            ret = Timer3_Read_Value(_speed->loop_timebase, &l_end);
+            l_ticks = (uint16)(l_end - l_start);
+            _state->stats.last_exec_ticks = l_ticks;
+            if(l_ticks > _state->stats.max_exec_ticks)
+            {
+                _state->stats.max_exec_ticks = l_ticks;
+            }
+            else{/*****Nothing*****/}
+            if(_state->stats.loop_runs > ZERO_INT)
+            {
+                l_ticks = (uint16)(l_start - _state->last_start);
+                if(l_ticks < _state->stats.min_period_ticks)
+                {
+                    _state->stats.min_period_ticks = l_ticks;
+                }
+                else{/*****Nothing*****/}
+                if(l_ticks > _state->stats.max_period_ticks)
+                {
+                    _state->stats.max_period_ticks = l_ticks;
+                }
+                else{/*****Nothing*****/}
+            }
+            else{/*****Nothing*****/}
+            _state->last_start = l_start;
+        }
+        else{/*****Nothing*****/}
+        _state->stats.loop_runs++;
+    }
+    return ret;
+}
+
+#endif
+
+#if DC_MOTOR_RAMP_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the DC Motor ramp state and write the start PWM duty.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param start_duty   : Start duty in duty ticks @Ref : CCP_Set_PWM_Duty_Raw.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_initialize(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state, uint16 start_duty)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _ramp) || (NULL == _state) || (NULL == _ramp->ramp_pwm) || (ZERO_INT == _ramp->slew_rate))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->ramp_active = STD_IDLE;
+        _state->duty = (uint32)start_duty << DC_MOTOR_RAMP_DUTY_SHIFT;
+        _state->remaining = ZERO_INT;
+        _state->step = ZERO_INT;
+        _state->duty_written = start_duty;
+        ret = CCP_Set_PWM_Duty_Raw(_ramp->ramp_pwm, start_duty);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To start a ramp from the current duty to a target duty.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param target_duty  : Target duty in duty ticks, 0 for a soft-stop.
+ * @Note               : All the increments are computed here, the ramp tick only adds and compares.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_start(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state, uint16 target_duty)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_target = (uint32)target_duty << DC_MOTOR_RAMP_DUTY_SHIFT;
+    if((NULL == _ramp) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : The ramp tick leaves the state alone while it is prepared. */
+        _state->ramp_active = STD_IDLE;
+        if(l_target >= _state->duty)
+        {
+            _state->ramp_up = STD_ON;
+            _state->remaining = l_target - _state->duty;
+        }
+        else
+        {
+            _state->ramp_up = STD_OFF;
+            _state->remaining = _state->duty - l_target;
+        }
+        _state->step_max = (uint32)_ramp->slew_rate << (DC_MOTOR_RAMP_DUTY_SHIFT - DC_MOTOR_RAMP_SLEW_SHIFT);
+        _state->accel_distance = ZERO_INT;
+        if((DC_MOTOR_RAMP_S_CURVE == _ramp->profile) && (_ramp->s_curve_ticks > 1))
+        {
+            _state->jerk = _state->step_max / _ramp->s_curve_ticks;
+            if(ZERO_INT == _state->jerk)
+            {
+                _state->jerk = 1;
+            }
+            else{/*****Nothing*****/}
+            _state->step = ZERO_INT;
+            _state->s_curve_phase = DC_MOTOR_RAMP_PHASE_ACCEL;
+        }
+        else
+        {
+            _state->jerk = ZERO_INT;
+            _state->step = _state->step_max;
+            _state->s_curve_phase = DC_MOTOR_RAMP_PHASE_CRUISE;
+        }
+        _state->ramp_active = STD_ACTIVE;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To check if the DC Motor ramp reached its target.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param ramp_done    : Pointer to the ramp status, STD_ON when the target is reached.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_is_done(dc_motor_ramp_state_t *_state, uint8 *ramp_done)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _state) || (NULL == ramp_done))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *ramp_done = (STD_ACTIVE == _state->ramp_active) ? STD_OFF : STD_ON;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To move the PWM duty one ramp step, called from the Timer2 interrupt.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_tick(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_duty = ZERO_INT;
+    if((NULL == _ramp) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(STD_ACTIVE == _state->ramp_active)
+    {
+        /* 
+         * @Brief : S-curve, the step grows by the jerk and shrinks again once the distance left
+         *          is the distance needed to bring it back down.
+         */
+        if(ZERO_INT != _state->jerk)
+        {
+            if((DC_MOTOR_RAMP_PHASE_DECEL != _state->s_curve_phase) && 
+               ((_state->remaining + _state->step) <= _state->accel_distance))
+            {
+                _state->s_curve_phase = DC_MOTOR_RAMP_PHASE_DECEL;
+            }
+            else{/*****Nothing*****/}
+            
+            if(DC_MOTOR_RAMP_PHASE_ACCEL == _state->s_curve_phase)
+            {
+                _state->step += _state->jerk;
+                if(_state->step >= _state->step_max)
+                {
+                    _state->step = _state->step_max;
+                    _state->s_curve_phase = DC_MOTOR_RAMP_PHASE_CRUISE;
+                }
+                else{/*****Nothing*****/}
+                _state->accel_distance += _state->step;
+            }
+            else if(DC_MOTOR_RAMP_PHASE_DECEL == _state->s_curve_phase)
+            {
+                _state->step = (_state->step > (_state->jerk << 1)) ? (_state->step - _state->jerk) : _state->jerk;
+            }
+            else{/*****Nothing*****/}
+        }
+        else{/*****Nothing*****/}
+        
+        if(_state->step >= _state->remaining)
+        {
+            /* @Brief : Target reached, it is written exactly. */
+            _state->duty = (STD_ON == _state->ramp_up) ? (_state->duty + _state->remaining) : 
+                                                          (_state->duty - _state->remaining);
+            _state->remaining = ZERO_INT;
+            _state->ramp_active = STD_IDLE;
+        }
+        else
+        {
+            _state->duty = (STD_ON == _state->ramp_up) ? (_state->duty + _state->step) : 
+                                                          (_state->duty - _state->step);
+            _state->remaining -= _state->step;
+        }
+        
+        /* @Brief : The CCP is written only when the whole duty ticks change. */
+        l_duty = (uint16)(_state->duty >> DC_MOTOR_RAMP_DUTY_SHIFT);
+        if(l_duty != _state->duty_written)
+        {
+            _state->duty_written = l_duty;
+            ret = CCP_Set_PWM_Duty_Raw(_ramp->ramp_pwm, l_duty);
+        }
+        else{/*****Nothing*****/}
+        
+        if((STD_IDLE == _state->ramp_active) && (NULL != _ramp->ramp_done_callback))
+        {
+            _ramp->ramp_done_callback();
+        }
+        else{/*****Nothing*****/}
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+#endif
+
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To run the speed PID with anti-windup for one loop.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param measured_rpm : Speed measured in this loop run.
+ * @Return PWM duty in per-mille.
+ */
+static uint16 dc_motor_speed_pid(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state, uint16 measured_rpm)
+{
+    sint32 l_error = ZERO_INT;
+    sint32 l_change = ZERO_INT;
+    sint32 l_integral = ZERO_INT;
+    sint32 l_output = ZERO_INT;
+    
+    if(ZERO_INT == _state->target_rpm)
+    {
+        /* @Brief : Stopped, nothing is left in the integral to kick the next start. */
+        _state->integral = ZERO_INT;
+    }
+    else
+    {
+        l_error = (sint32)_state->target_rpm - (sint32)measured_rpm;
+        l_change = (sint32)measured_rpm - (sint32)_state->measured_rpm;
+        /* @Brief : Saturated before the multiplies, the integral is kept inside the full duty range below. */
+        if(l_error > DC_MOTOR_SPEED_ERROR_LIMIT)
+        {
+            l_error = DC_MOTOR_SPEED_ERROR_LIMIT;
+        }
+        else if(l_error < -DC_MOTOR_SPEED_ERROR_LIMIT)
+        {
+            l_error = -DC_MOTOR_SPEED_ERROR_LIMIT;
+        }
+        else{/*****Nothing*****/}
+        if(l_change > DC_MOTOR_SPEED_ERROR_LIMIT)
+        {
+            l_change = DC_MOTOR_SPEED_ERROR_LIMIT;
+        }
+        else if(l_change < -DC_MOTOR_SPEED_ERROR_LIMIT)
+        {
+            l_change = -DC_MOTOR_SPEED_ERROR_LIMIT;
+        }
+        else{/*****Nothing*****/}
+        l_integral = _state->integral + ((sint32)_speed->ki * l_error);
+        /* @Brief : Derivative on the measurement, a target change does not kick the output. */
+        l_output = ((sint32)_speed->kp * l_error) + l_integral - ((sint32)_speed->kd * l_change);
+        l_output /= ((sint32)1 << DC_MOTOR_SPEED_Q_SHIFT);
+        
+        /* @Brief : Anti-windup, the integral only moves while the output is not saturated in the error direction. */
+        if(l_output > DC_MOTOR_SPEED_DUTY_MAX)
+        {
+            l_output = DC_MOTOR_SPEED_DUTY_MAX;
+            if(l_error < ZERO_INT)
+            {
+                _state->integral = l_integral;
+            }
+            else{/*****Nothing*****/}
+        }
+        else if(l_output < ZERO_INT)
+        {
+            l_output = ZERO_INT;
+            if(l_error > ZERO_INT)
+            {
+                _state->integral = l_integral;
+            }
+            else{/*****Nothing*****/}
+        }
+        else
+        {
+            _state->integral = l_integral;
+        }
+        
+        /* @Brief : The integral alone never asks for more than the full duty range. */
+        if(_state->integral > (DC_MOTOR_SPEED_DUTY_MAX << DC_MOTOR_SPEED_Q_SHIFT))
+        {
+            _state->integral = (DC_MOTOR_SPEED_DUTY_MAX << DC_MOTOR_SPEED_Q_SHIFT);
+        }
+        else if(_state->integral < ZERO_INT)
+        {
+            _state->integral = ZERO_INT;
+        }
+        else{/*****Nothing*****/}
+    }
+    return (uint16)l_output;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
@@ -12,6 +12,14 @@
 /**************************Includes-Section*****************************/
 #include "ecu_dc_motor_cfg.h"
 #include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#if (DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE) || (DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE) || \
+    (DC_MOTOR_RAMP_CFG==CONFIG_ENABLE)
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+#endif
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+#include "../../MCAL_Layer/Timer1/hal_timer1.h"
+#include "../../MCAL_Layer/Timer3/hal_timer3.h"
+#endif
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
@@ -23,6 +31,9 @@
 /* @Brief : Macros for DC Motor pins configuration. */
 #define DC_MOTOR_PIN1 0x00U
 #define DC_MOTOR_PIN2 0x01U
+
+/* @Brief : Macro for the fraction bits of the ramp slew rate, in duty ticks per 256 ramp ticks. */
+#define DC_MOTOR_RAMP_SLEW_SHIFT 8
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -35,7 +46,88 @@
 typedef struct
 {
     pin_config_t dc_motor_pin[2]; /* @Brief : DC Motor pins configuration. */
+#if DC_MOTOR_ECCP_BRIDGE_CFG==CONFIG_ENABLE
+    const ccp_t *dc_motor_bridge; /* @Brief : ECCP1 in full-bridge PWM mode, NULL to use the DC Motor pins. */
+#endif
 }dc_motor_t;
+
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+/* 
+ * @Brief : DC Motor closed-loop speed control configuration.
+ * @Note  : Gains are in per-mille of PWM duty per RPM of error, Q8 (DC_MOTOR_SPEED_Q_SHIFT).
+ */
+typedef struct
+{
+    const dc_motor_t *dc_motor;          /* @Brief : DC Motor direction pins. */
+    const ccp_t *motor_pwm;              /* @Brief : CCP in PWM mode driving the DC Motor bridge enable. */
+    const timer1_t *encoder_counter;     /* @Brief : Timer1 in counter mode counting the encoder pulses. */
+    const timer3_t *loop_timebase;       /* @Brief : Free running Timer3 for the loop timing statistics, NULL if not used. */
+    uint16 encoder_pulses_per_rev;       /* @Brief : Encoder pulses per shaft revolution. */
+    uint16 loop_frequency;               /* @Brief : Rate of the dc_motor_speed_task calls in Hz. */
+    sint16 kp;                           /* @Brief : Proportional gain. */
+    sint16 ki;                           /* @Brief : Integral gain, applied once per loop. */
+    sint16 kd;                           /* @Brief : Derivative gain, applied once per loop. */
+}dc_motor_speed_t;
+
+/* @Brief : DC Motor speed loop timing statistics in Timer3 ticks. */
+typedef struct
+{
+    uint32 loop_runs;                    /* @Brief : Number of speed loop runs. */
+    uint16 last_exec_ticks;              /* @Brief : Execution time of the last speed loop run. */
+    uint16 max_exec_ticks;               /* @Brief : Longest execution time of the speed loop. */
+    uint16 min_period_ticks;             /* @Brief : Shortest time between two speed loop runs. */
+    uint16 max_period_ticks;             /* @Brief : Longest time between two speed loop runs. */
+}dc_motor_loop_stats_t;
+
+/* @Brief : DC Motor speed control state, one for each controlled DC Motor. */
+typedef struct
+{
+    volatile uint16 target_rpm;          /* @Brief : Requested speed, 0 stops the PWM. */
+    volatile uint16 measured_rpm;        /* @Brief : Speed measured at the last loop run. */
+    volatile uint16 duty_permille;       /* @Brief : PWM duty applied at the last loop run. */
+    uint16 last_count;                   /* @Brief : Encoder counter value at the last loop run. */
+    uint16 last_start;                   /* @Brief : Timer3 value at the start of the last loop run. */
+    uint32 rpm_per_pulse;                /* @Brief : RPM of one encoder pulse per loop in Q8, computed at initialize. */
+    uint32 pulses_limit;                 /* @Brief : Pulses per loop read as the largest speed, computed at initialize. */
+    sint32 integral;                     /* @Brief : PID integral term in Q8 duty per-mille. */
+    volatile dc_motor_loop_stats_t stats;/* @Brief : Speed loop timing statistics. */
+}dc_motor_speed_state_t;
+#endif
+
+#if DC_MOTOR_RAMP_CFG==CONFIG_ENABLE
+/* @Brief : DC Motor PWM duty ramp profiles. */
+typedef enum
+{
+    DC_MOTOR_RAMP_LINEAR = 0,            /* @Brief : Constant slew rate from start to target. */
+    DC_MOTOR_RAMP_S_CURVE                /* @Brief : Slew rate grows, holds then shrinks again near the target. */
+}dc_motor_ramp_profile_t;
+
+/* @Brief : DC Motor PWM duty ramp configuration. */
+typedef struct
+{
+    const ccp_t *ramp_pwm;               /* @Brief : CCP in PWM mode driving the DC Motor. */
+    void (*ramp_done_callback)(void);    /* @Brief : Called from the ramp tick when the target is reached, NULL if not used. */
+    dc_motor_ramp_profile_t profile;     /* @Brief : Ramp profile. */
+    uint16 slew_rate;                    /* @Brief : Largest duty change in duty ticks per 256 ramp ticks. */
+    uint16 s_curve_ticks;                /* @Brief : S-curve ramp ticks to reach the slew rate from 0. */
+}dc_motor_ramp_t;
+
+/* @Brief : DC Motor PWM duty ramp state, duty values in duty ticks with 16 fraction bits. */
+typedef struct
+{
+    uint32 duty;                         /* @Brief : Current duty. */
+    uint32 remaining;                    /* @Brief : Distance left to the target duty. */
+    uint32 step;                         /* @Brief : Duty change of the next ramp tick. */
+    uint32 step_max;                     /* @Brief : Slew rate per ramp tick. */
+    uint32 jerk;                         /* @Brief : S-curve step change per ramp tick. */
+    uint32 accel_distance;               /* @Brief : S-curve distance covered while the step was growing. */
+    uint16 duty_written;                 /* @Brief : Duty ticks last written to the CCP. */
+    uint8 ramp_up : 1;                   /* @Brief : 1 when the target is above the start duty. */
+    uint8 s_curve_phase : 2;             /* @Brief : S-curve phase. */
+    uint8 reserved : 5;                  /* @Brief : Reserved bits. */
+    volatile uint8 ramp_active;          /* @Brief : STD_ACTIVE while the ramp runs. */
+}dc_motor_ramp_state_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -51,6 +143,7 @@ Std_ReturnType dc_motor_initialize(const dc_motor_t *_dc_motor);
 /*
  * @Brief              : To make the DC Motor move right.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge forward, the speed is the CCP PWM duty.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
@@ -60,6 +153,7 @@ Std_ReturnType dc_motor_move_right(const dc_motor_t *_dc_motor);
 /*
  * @Brief              : To make the DC Motor move left.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge reverse, the speed is the CCP PWM duty.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
@@ -69,11 +163,111 @@ Std_ReturnType dc_motor_move_left(const dc_motor_t *_dc_motor);
 /*
  * @Brief              : To stop the DC Motor.
  * @Param _dc_motor    : Pointer to the DC Motor module configurations.
+ * @Note               : With dc_motor_bridge, Sets the full-bridge PWM duty to 0, it has to be set again after the next move.
  * @Return Status of the function.
  *          (E_OK)     : The function done successfully.
  *          (E_NOT_OK) : The function has issue while performing this action.
  */
 Std_ReturnType dc_motor_stop(const dc_motor_t *_dc_motor);
+
+#if DC_MOTOR_SPEED_CONTROL_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the DC Motor pins and its speed control state with the PWM duty at 0.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Note               : The CCP, Timer1 and Timer3 modules are initialized by the application.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or one encoder pulse
+ *                       per loop is below 1/256 RPM.
+ */
+Std_ReturnType dc_motor_speed_initialize(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state);
+
+/*
+ * @Brief              : To set the DC Motor target speed.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param target_rpm   : Target speed in RPM, 0 stops the PWM.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_set_target(dc_motor_speed_state_t *_state, uint16 target_rpm);
+
+/*
+ * @Brief              : To read the DC Motor speed measured at the last loop run.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param measured_rpm : Pointer to the measured speed in RPM.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_get_measured(dc_motor_speed_state_t *_state, uint16 *measured_rpm);
+
+/*
+ * @Brief              : To read a coherent copy of the DC Motor speed loop timing statistics.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Param stats        : Pointer to the copy of the loop timing statistics.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_get_stats(dc_motor_speed_state_t *_state, dc_motor_loop_stats_t *stats);
+
+/*
+ * @Brief              : To measure the speed and run the speed PID, called from a periodic timer interrupt.
+ * @Param _speed       : Pointer to the DC Motor speed control configurations.
+ * @Param _state       : Pointer to the DC Motor speed control state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_speed_task(const dc_motor_speed_t *_speed, dc_motor_speed_state_t *_state);
+#endif
+
+#if DC_MOTOR_RAMP_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the DC Motor ramp state and write the start PWM duty.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param start_duty   : Start duty in duty ticks @Ref : CCP_Set_PWM_Duty_Raw.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_initialize(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state, uint16 start_duty);
+
+/*
+ * @Brief              : To start a ramp from the current duty to a target duty.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param target_duty  : Target duty in duty ticks, 0 for a soft-stop.
+ * @Note               : All the increments are computed here, the ramp tick only adds and compares.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_start(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state, uint16 target_duty);
+
+/*
+ * @Brief              : To check if the DC Motor ramp reached its target.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Param ramp_done    : Pointer to the ramp status, STD_ON when the target is reached.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_is_done(dc_motor_ramp_state_t *_state, uint8 *ramp_done);
+
+/*
+ * @Brief              : To move the PWM duty one ramp step, called from the Timer2 interrupt.
+ * @Param _ramp        : Pointer to the DC Motor ramp configurations.
+ * @Param _state       : Pointer to the DC Motor ramp state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType dc_motor_ramp_tick(const dc_motor_ramp_t *_ramp, dc_motor_ramp_state_t *_state);
+#endif
 /***********************************************************************/
 #endif	/* ECU_DC_MOTOR_H */
 
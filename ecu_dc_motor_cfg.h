@@ -14,7 +14,27 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macro to let a DC Motor be driven by the ECCP1 full-bridge instead of its two direction pins.
+ * @Note  : Needs CCP1_ECCP_CFG with CCP1 in full-bridge PWM mode.
+ */
+#define DC_MOTOR_ECCP_BRIDGE_CFG        CONFIG_DISABLE
+
+/* 
+ * @Brief : Macro to enable the DC Motor closed-loop speed control.
+ * @Note  : Needs a CCP in PWM mode, Timer1 in counter mode for the encoder pulses
+ *          and Timer3 free running when the loop timing statistics are used.
+ */
+#define DC_MOTOR_SPEED_CONTROL_CFG      CONFIG_DISABLE
+
+/* @Brief : Macro for the fraction bits of the speed PID gains and of the RPM scale. */
+#define DC_MOTOR_SPEED_Q_SHIFT          8
 
+/* 
+ * @Brief : Macro to enable the DC Motor PWM duty ramp generator (soft-start and soft-stop).
+ * @Note  : Needs a CCP in PWM mode, dc_motor_ramp_tick is called from the Timer2 interrupt.
+ */
+#define DC_MOTOR_RAMP_CFG               CONFIG_DISABLE
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -21,6 +21,47 @@ static const uint8 btn_values[ECU_KEYPAD_ROWS][ECU_KEYPAD_COLUMNS] =
     {'1', '2', '3', '-'},
     {'#', '0', '=', '+'}
 };
+
+/*
+ * @Brief              : To push an event to the KeyPad events FIFO, the event is dropped if the FIFO is full.
+ * @Param fifo         : Pointer to the KeyPad events FIFO.
+ * @Param key          : Key value.
+ * @Param type         : Event type.
+ */
+static void keypad_push_event(keypad_event_fifo_t *fifo, uint8 key, keypad_event_type_t type);
+
+#if KEYPAD_SCANNER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To debounce one key sample and push its press, release and repeat events.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Param key_index    : Key index, row * ECU_KEYPAD_COLUMNS + column.
+ * @Param key_logic    : Key sample, (GPIO_HIGH) for pressed key.
+ */
+static void keypad_scanner_update_key(keypad_scanner_t *scanner, uint8 key_index, logic_t key_logic);
+#endif
+
+#if (KEYPAD_SCANNER_CFG==CONFIG_ENABLE) && (KEYPAD_WAKEUP_CFG==CONFIG_ENABLE)
+/*
+ * @Brief : KeyPad and scanner state using the wake up mode.
+ */
+static const keypad_t *wakeup_keypad = NULL;
+static keypad_scanner_t *wakeup_scanner = NULL;
+
+/*
+ * @Brief              : To drive all KeyPad rows so any key press changes its column, then stop the scanner.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType keypad_wakeup_arm(const keypad_t *_keypad_obj, keypad_scanner_t *scanner);
+
+/*
+ * @Brief : KeyPad columns RBx interrupt on change handler, starts the scanner from the first row.
+ */
+static void keypad_wakeup_handler(void);
+#endif
 /***********************************************************************/
 
 /*****************Software Interfaces Functions-Section*****************/
@@ -96,4 +137,470 @@ Std_ReturnType keypad_get_value(const keypad_t *_keypad_obj, uint8 *value)
     }
     return ret;
 }
+
+/*
+ * @Brief              : To get the oldest KeyPad event.
+ * @Param fifo         : Pointer to the KeyPad events FIFO.
+ * @Param event        : Pointer to the event, its type is KEYPAD_EVENT_NONE if there is no event.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_get_event(keypad_event_fifo_t *fifo, keypad_event_t *event)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == fifo) || (NULL == event))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(fifo->tail == fifo->head)
+        {
+            event->type = KEYPAD_EVENT_NONE;
+        }
+        else
+        {
+            *event = fifo->events[fifo->tail];
+            fifo->tail = (fifo->tail + 1) % KEYPAD_EVENT_FIFO_SIZE;
+        }
+    }
+    return ret;
+}
+
+#if KEYPAD_SCANNER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the KeyPad pins and the scanner state, the first row is driven.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_scanner_initialize(const keypad_t *_keypad_obj, keypad_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_counter = ZERO_INT;
+    if((NULL == _keypad_obj) || (NULL == scanner))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = keypad_initialize(_keypad_obj);
+        for(l_counter = ZERO_INT; l_counter < ECU_KEYPAD_ROWS; l_counter++)
+        {
+            ret = gpio_pin_write_logic(&(_keypad_obj->keypad_rows_pins[l_counter]), GPIO_LOW);
+        }
+        for(l_counter = ZERO_INT; l_counter < ECU_KEYPAD_KEYS; l_counter++)
+        {
+            scanner->keys_debounce[l_counter] = ZERO_INT;
+        }
+        scanner->fifo.head = ZERO_INT;
+        scanner->fifo.tail = ZERO_INT;
+        scanner->keys_state = ZERO_INT;
+        scanner->active_row = ZERO_INT;
+        scanner->repeat_key = ECU_KEYPAD_NO_KEY;
+        scanner->repeat_scans = ZERO_INT;
+#if KEYPAD_WAKEUP_CFG==CONFIG_ENABLE
+        scanner->idle = STD_OFF;
+#endif
+        ret = gpio_pin_write_logic(&(_keypad_obj->keypad_rows_pins[ZERO_INT]), GPIO_HIGH);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To scan one KeyPad row, called every tick from a timer interrupt or the main loop.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : The driven row is read on the next tick, so the tick period is the settling time.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_scanner_tick(const keypad_t *_keypad_obj, keypad_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_columns_counter = ZERO_INT;
+#if KEYPAD_WAKEUP_CFG==CONFIG_ENABLE
+    uint8 l_keys_counter = ZERO_INT;
+    uint8 l_bouncing_keys = ZERO_INT;
+#endif
+    logic_t column_logic = GPIO_LOW;
+    if((NULL == _keypad_obj) || (NULL == scanner))
+    {
+        ret = E_NOT_OK;
+    }
+#if KEYPAD_WAKEUP_CFG==CONFIG_ENABLE
+    else if(STD_ON == scanner->idle)
+    {
+        /* @Brief : Nothing to scan until the wake up interrupt. */
+    }
+#endif
+    else
+    {
+        for(l_columns_counter = ZERO_INT; l_columns_counter < ECU_KEYPAD_COLUMNS; l_columns_counter++)
+        {
+            ret = gpio_pin_read_logic(&(_keypad_obj->keypad_columns_pins[l_columns_counter]), &column_logic);
+            keypad_scanner_update_key(scanner, (scanner->active_row * ECU_KEYPAD_COLUMNS) + l_columns_counter, column_logic);
+        }
+        ret = gpio_pin_write_logic(&(_keypad_obj->keypad_rows_pins[scanner->active_row]), GPIO_LOW);
+        scanner->active_row++;
+        if(ECU_KEYPAD_ROWS == scanner->active_row)
+        {
+            scanner->active_row = ZERO_INT;
+            /* @Brief : Auto repeat of the last pressed key, counted in full scans. */
+            if(ECU_KEYPAD_NO_KEY != scanner->repeat_key)
+            {
+                scanner->repeat_scans--;
+                if(ZERO_INT == scanner->repeat_scans)
+                {
+                    keypad_push_event(&(scanner->fifo), btn_values[scanner->repeat_key / ECU_KEYPAD_COLUMNS][scanner->repeat_key % ECU_KEYPAD_COLUMNS], 
+                                      KEYPAD_EVENT_REPEATED);
+                    scanner->repeat_scans = KEYPAD_REPEAT_RATE_SCANS;
+                }
+                else{/*****Nothing*****/}
+            }
+            else{/*****Nothing*****/}
+        }
+        else{/*****Nothing*****/}
+        ret = gpio_pin_write_logic(&(_keypad_obj->keypad_rows_pins[scanner->active_row]), GPIO_HIGH);
+#if KEYPAD_WAKEUP_CFG==CONFIG_ENABLE
+        /* @Brief : All keys released and stable after a full scan, go back to wait for the interrupt. */
+        if((_keypad_obj == wakeup_keypad) && (ZERO_INT == scanner->active_row) && (ZERO_INT == scanner->keys_state))
+        {
+            for(l_keys_counter = ZERO_INT; l_keys_counter < ECU_KEYPAD_KEYS; l_keys_counter++)
+            {
+                if(ZERO_INT != scanner->keys_debounce[l_keys_counter])
+                {
+                    l_bouncing_keys++;
+                }
+                else{/*****Nothing*****/}
+            }
+            if(ZERO_INT == l_bouncing_keys)
+            {
+                ret = keypad_wakeup_arm(_keypad_obj, scanner);
+            }
+            else{/*****Nothing*****/}
+        }
+        else{/*****Nothing*****/}
+#endif
+    }
+    return ret;
+}
+#endif
+
+#if KEYPAD_ANALOG_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the analog KeyPad scanner state and start the first conversion.
+ * @Param _keypad_obj  : Pointer to the analog KeyPad configurations.
+ * @Param scanner      : Pointer to the analog KeyPad scanner state.
+ * @Note               : The ADC module has to be initialized before.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_analog_initialize(const keypad_analog_t *_keypad_obj, keypad_analog_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _keypad_obj) || (NULL == scanner) || (NULL == _keypad_obj->keypad_adc) || 
+       (NULL == _keypad_obj->keys_thresholds) || (NULL == _keypad_obj->keys_values) || 
+       (ZERO_INT == _keypad_obj->keys_number) || (ECU_KEYPAD_NO_KEY == _keypad_obj->keys_number))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        scanner->fifo.head = ZERO_INT;
+        scanner->fifo.tail = ZERO_INT;
+        scanner->key_index = ECU_KEYPAD_NO_KEY;
+        scanner->candidate_index = ECU_KEYPAD_NO_KEY;
+        scanner->candidate_samples = ZERO_INT;
+        scanner->repeat_ticks = ZERO_INT;
+        ret = ADC_SelectChannel(_keypad_obj->keypad_adc, _keypad_obj->keypad_channel);
+        ret = ADC_StartConversion(_keypad_obj->keypad_adc);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To classify the last conversion and start the next one, called every tick.
+ * @Param _keypad_obj  : Pointer to the analog KeyPad configurations.
+ * @Param scanner      : Pointer to the analog KeyPad scanner state.
+ * @Note               : Events are read with keypad_get_event, repeat times match a matrix KeyPad ticked as often.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_analog_tick(const keypad_analog_t *_keypad_obj, keypad_analog_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_conversion_status = ZERO_INT;
+    uint8 l_key_index = ZERO_INT;
+    adc_result_t l_result = ZERO_INT;
+    if((NULL == _keypad_obj) || (NULL == scanner))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = ADC_IsConversionDone(_keypad_obj->keypad_adc, &l_conversion_status);
+        if(ZERO_INT != l_conversion_status)
+        {
+            ret = ADC_GetConversionResult(_keypad_obj->keypad_adc, &l_result);
+            /* @Brief : The first threshold above the result is the pressed key. */
+            for(l_key_index = ZERO_INT; (l_key_index < _keypad_obj->keys_number) && 
+                (l_result > _keypad_obj->keys_thresholds[l_key_index]); l_key_index++);
+            if(l_key_index == _keypad_obj->keys_number)
+            {
+                l_key_index = ECU_KEYPAD_NO_KEY;
+            }
+            else{/*****Nothing*****/}
+            /* @Brief : A new candidate counts this sample as its first one, as the matrix scan debounce does. */
+            if(l_key_index != scanner->candidate_index)
+            {
+                scanner->candidate_index = l_key_index;
+                scanner->candidate_samples = ZERO_INT;
+            }
+            else{/*****Nothing*****/}
+            if(l_key_index == scanner->key_index)
+            {
+                /* @Brief : Same key held, auto repeat. */
+                if(ECU_KEYPAD_NO_KEY != l_key_index)
+                {
+                    scanner->repeat_ticks--;
+                    if(ZERO_INT == scanner->repeat_ticks)
+                    {
+                        keypad_push_event(&(scanner->fifo), _keypad_obj->keys_values[l_key_index], KEYPAD_EVENT_REPEATED);
+                        scanner->repeat_ticks = KEYPAD_ANALOG_REPEAT_RATE_TICKS;
+                    }
+                    else{/*****Nothing*****/}
+                }
+                else{/*****Nothing*****/}
+            }
+            else
+            {
+                scanner->candidate_samples++;
+                if(KEYPAD_DEBOUNCE_SAMPLES <= scanner->candidate_samples)
+                {
+                    /* @Brief : A ladder reads one key only, the old key is released before the new one is pressed. */
+                    if(ECU_KEYPAD_NO_KEY != scanner->key_index)
+                    {
+                        keypad_push_event(&(scanner->fifo), _keypad_obj->keys_values[scanner->key_index], KEYPAD_EVENT_RELEASED);
+                    }
+                    else{/*****Nothing*****/}
+                    if(ECU_KEYPAD_NO_KEY != l_key_index)
+                    {
+                        keypad_push_event(&(scanner->fifo), _keypad_obj->keys_values[l_key_index], KEYPAD_EVENT_PRESSED);
+                    }
+                    else{/*****Nothing*****/}
+                    scanner->key_index = l_key_index;
+                    scanner->candidate_samples = ZERO_INT;
+                    scanner->repeat_ticks = KEYPAD_ANALOG_REPEAT_DELAY_TICKS;
+                }
+                else{/*****Nothing*****/}
+            }
+            ret = ADC_SelectChannel(_keypad_obj->keypad_adc, _keypad_obj->keypad_channel);
+            ret = ADC_StartConversion(_keypad_obj->keypad_adc);
+        }
+        else{/*****Nothing*****/}
+    }
+    return ret;
+}
+#endif
+
+#if (KEYPAD_SCANNER_CFG==CONFIG_ENABLE) && (KEYPAD_WAKEUP_CFG==CONFIG_ENABLE)
+/*
+ * @Brief              : Initialize the KeyPad scanner in wake up mode, the columns have to be on RB4 to RB7.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : Only one KeyPad can use the wake up mode, keypad_scanner_tick returns at once while idle.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_wakeup_initialize(const keypad_t *_keypad_obj, keypad_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_columns_counter = ZERO_INT;
+    interrupt_RBx_t column_interrupt = 
+    {
+        .EXT_InterruptHandler_HIGH = keypad_wakeup_handler,
+        .EXT_InterruptHandler_LOW = keypad_wakeup_handler,
+        .priority = KEYPAD_WAKEUP_PRIORITY
+    };
+    if((NULL == _keypad_obj) || (NULL == scanner))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_columns_counter = ZERO_INT; l_columns_counter < ECU_KEYPAD_COLUMNS; l_columns_counter++)
+        {
+            if((PORTB_INDEX != _keypad_obj->keypad_columns_pins[l_columns_counter].port) || 
+               (GPIO_PIN4 > _keypad_obj->keypad_columns_pins[l_columns_counter].pin))
+            {
+                ret = E_NOT_OK;
+            }
+            else{/*****Nothing*****/}
+        }
+        if(E_OK == ret)
+        {
+            ret = keypad_scanner_initialize(_keypad_obj, scanner);
+            ret = keypad_wakeup_arm(_keypad_obj, scanner);
+            wakeup_scanner = scanner;
+            wakeup_keypad = _keypad_obj;
+            /* @Brief : Both edges are handled so the interrupt manager follows every column change. */
+            for(l_columns_counter = ZERO_INT; l_columns_counter < ECU_KEYPAD_COLUMNS; l_columns_counter++)
+            {
+                column_interrupt.mcu_pin = _keypad_obj->keypad_columns_pins[l_columns_counter];
+                ret = Interrupt_RBx_Init(&column_interrupt);
+            }
+        }
+        else{/*****Nothing*****/}
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To put the MCU to sleep if the KeyPad is idle and all its events are read.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : The MCU wakes up on the first key press. The idle check and SLEEP run with the
+ *                       global interrupts disabled, the key press interrupt is served after the wake up.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_wakeup_sleep(const keypad_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if(NULL == scanner)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 
+         * Brief : A key press served between the idle check and SLEEP would be slept through. With GIE
+         *         cleared its flag stays pending, a pending enabled interrupt flag still wakes the core
+         *         (or makes SLEEP a NOP) and the handler runs once GIE is restored.
+         */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        if((STD_ON == scanner->idle) && (scanner->fifo.head == scanner->fifo.tail))
+        {
+            SLEEP();
+            NOP();
+        }
+        else{/*****Nothing*****/}
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+#endif
+
+/*
+ * @Brief              : To push an event to the KeyPad events FIFO, the event is dropped if the FIFO is full.
+ * @Param fifo         : Pointer to the KeyPad events FIFO.
+ * @Param key          : Key value.
+ * @Param type         : Event type.
+ */
+static void keypad_push_event(keypad_event_fifo_t *fifo, uint8 key, keypad_event_type_t type)
+{
+    uint8 l_next_head = (fifo->head + 1) % KEYPAD_EVENT_FIFO_SIZE;
+    if(l_next_head != fifo->tail)
+    {
+        fifo->events[fifo->head].key = key;
+        fifo->events[fifo->head].type = type;
+        fifo->head = l_next_head;
+    }
+    else{/*****Nothing*****/}
+}
+
+#if KEYPAD_SCANNER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To debounce one key sample and push its press, release and repeat events.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Param key_index    : Key index, row * ECU_KEYPAD_COLUMNS + column.
+ * @Param key_logic    : Key sample, (GPIO_HIGH) for pressed key.
+ */
+static void keypad_scanner_update_key(keypad_scanner_t *scanner, uint8 key_index, logic_t key_logic)
+{
+    uint16 l_key_mask = (uint16)1 << key_index;
+    uint8 l_key_state = ((scanner->keys_state & l_key_mask) ? GPIO_HIGH : GPIO_LOW);
+    uint8 l_key = btn_values[key_index / ECU_KEYPAD_COLUMNS][key_index % ECU_KEYPAD_COLUMNS];
+    if(key_logic == l_key_state)
+    {
+        scanner->keys_debounce[key_index] = ZERO_INT;
+    }
+    else
+    {
+        scanner->keys_debounce[key_index]++;
+        if(KEYPAD_DEBOUNCE_SAMPLES <= scanner->keys_debounce[key_index])
+        {
+            scanner->keys_debounce[key_index] = ZERO_INT;
+            scanner->keys_state ^= l_key_mask;
+            if(GPIO_HIGH == key_logic)
+            {
+                keypad_push_event(&(scanner->fifo), l_key, KEYPAD_EVENT_PRESSED);
+                scanner->repeat_key = key_index;
+                scanner->repeat_scans = KEYPAD_REPEAT_DELAY_SCANS;
+            }
+            else
+            {
+                keypad_push_event(&(scanner->fifo), l_key, KEYPAD_EVENT_RELEASED);
+                if(key_index == scanner->repeat_key)
+                {
+                    scanner->repeat_key = ECU_KEYPAD_NO_KEY;
+                }
+                else{/*****Nothing*****/}
+            }
+        }
+        else{/*****Nothing*****/}
+    }
+}
+#endif
+
+#if (KEYPAD_SCANNER_CFG==CONFIG_ENABLE) && (KEYPAD_WAKEUP_CFG==CONFIG_ENABLE)
+/*
+ * @Brief              : To drive all KeyPad rows so any key press changes its column, then stop the scanner.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType keypad_wakeup_arm(const keypad_t *_keypad_obj, keypad_scanner_t *scanner)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rows_counter = ZERO_INT;
+    for(l_rows_counter = ZERO_INT; l_rows_counter < ECU_KEYPAD_ROWS; l_rows_counter++)
+    {
+        ret = gpio_pin_write_logic(&(_keypad_obj->keypad_rows_pins[l_rows_counter]), GPIO_HIGH);
+    }
+    scanner->active_row = ZERO_INT;
+    scanner->idle = STD_ON;
+    return ret;
+}
+
+/*
+ * @Brief : KeyPad columns RBx interrupt on change handler, starts the scanner from the first row.
+ */
+static void keypad_wakeup_handler(void)
+{
+    uint8 l_rows_counter = ZERO_INT;
+    if((NULL != wakeup_scanner) && (STD_ON == wakeup_scanner->idle))
+    {
+        for(l_rows_counter = 1; l_rows_counter < ECU_KEYPAD_ROWS; l_rows_counter++)
+        {
+            gpio_pin_write_logic(&(wakeup_keypad->keypad_rows_pins[l_rows_counter]), GPIO_LOW);
+        }
+        wakeup_scanner->active_row = ZERO_INT;
+        wakeup_scanner->idle = STD_OFF;
+    }
+    else{/*****Nothing*****/}
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
@@ -12,6 +12,8 @@
 /**************************Includes-Section*****************************/
 #include "ecu_keypad_cfg.h"
 #include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#include "../../MCAL_Layer/Interrupt/mcal_external_interrupt.h"
+#include "../../MCAL_Layer/ADC/hal_adc.h"
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
@@ -19,6 +21,13 @@
 #define ECU_KEYPAD_ROWS    4
 /* Brief : KeyPad columns configuration. */
 #define ECU_KEYPAD_COLUMNS 4
+/* Brief : KeyPad number of keys. */
+#define ECU_KEYPAD_KEYS    (ECU_KEYPAD_ROWS * ECU_KEYPAD_COLUMNS)
+/* Brief : KeyPad no key index. */
+#define ECU_KEYPAD_NO_KEY  0xFF
+/* Brief : Analog KeyPad repeat times in ticks, one matrix KeyPad full scan takes ECU_KEYPAD_ROWS ticks. */
+#define KEYPAD_ANALOG_REPEAT_DELAY_TICKS  ((uint16)(KEYPAD_REPEAT_DELAY_SCANS * ECU_KEYPAD_ROWS))
+#define KEYPAD_ANALOG_REPEAT_RATE_TICKS   ((uint16)(KEYPAD_REPEAT_RATE_SCANS * ECU_KEYPAD_ROWS))
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -32,6 +41,76 @@ typedef struct
     pin_config_t keypad_rows_pins[ECU_KEYPAD_ROWS];       /* Brief : KeyPad rows configuration. */
     pin_config_t keypad_columns_pins[ECU_KEYPAD_COLUMNS]; /* Brief : KeyPad columns configuration. */
 }keypad_t;
+
+/* Brief : KeyPad event types. */
+typedef enum
+{
+    KEYPAD_EVENT_NONE = 0,      /* Brief : No event, the events FIFO is empty. */
+    KEYPAD_EVENT_PRESSED,       /* Brief : Key pressed event. */
+    KEYPAD_EVENT_RELEASED,      /* Brief : Key released event. */
+    KEYPAD_EVENT_REPEATED       /* Brief : Key held auto repeat event. */
+}keypad_event_type_t;
+
+/* Brief : KeyPad event. */
+typedef struct
+{
+    uint8 key;                  /* Brief : Key value. */
+    keypad_event_type_t type;   /* Brief : Event type. */
+}keypad_event_t;
+
+/* 
+ * Brief : KeyPad events FIFO.
+ * Note  : Events are pushed by the tick only and popped by keypad_get_event only, 
+ *         so the tick can run in an interrupt while the application reads the events.
+ */
+typedef struct
+{
+    keypad_event_t events[KEYPAD_EVENT_FIFO_SIZE];  /* Brief : Events buffer. */
+    volatile uint8 head;                            /* Brief : Next event to be pushed. */
+    volatile uint8 tail;                            /* Brief : Next event to be popped. */
+}keypad_event_fifo_t;
+
+#if KEYPAD_ANALOG_CFG==CONFIG_ENABLE
+/* 
+ * Brief : Resistor ladder analog KeyPad configuration.
+ * Note  : keys_thresholds[i] is the highest ADC result of key i in ascending order, 
+ *         results above the last threshold mean no key is pressed.
+ */
+typedef struct
+{
+    const adc_config_t *keypad_adc;     /* Brief : ADC module configurations. */
+    adc_channel_select_t keypad_channel;/* Brief : KeyPad ADC channel. */
+    const adc_result_t *keys_thresholds;/* Brief : Calibrated thresholds table, kept in program memory. */
+    const uint8 *keys_values;           /* Brief : Key value of each threshold, kept in program memory. */
+    uint8 keys_number;                  /* Brief : Number of keys. */
+}keypad_analog_t;
+
+/* Brief : Resistor ladder analog KeyPad scanner state. */
+typedef struct
+{
+    keypad_event_fifo_t fifo;           /* Brief : KeyPad events FIFO. */
+    uint8 key_index;                    /* Brief : Debounced pressed key, @Ref : ECU_KEYPAD_NO_KEY. */
+    uint8 candidate_index;              /* Brief : Key found by the last samples. */
+    uint8 candidate_samples;            /* Brief : Number of equal samples of the candidate key. */
+    uint16 repeat_ticks;                /* Brief : Ticks left to the next repeat event. */
+}keypad_analog_scanner_t;
+#endif
+
+#if KEYPAD_SCANNER_CFG==CONFIG_ENABLE
+/* Brief : KeyPad scanner state. */
+typedef struct
+{
+    keypad_event_fifo_t fifo;                           /* Brief : KeyPad events FIFO. */
+    uint16 keys_state;                                  /* Brief : Debounced keys state, one bit for each key. */
+    uint8 keys_debounce[ECU_KEYPAD_KEYS];               /* Brief : Number of samples each key is different from its state. */
+    uint8 active_row;                                   /* Brief : Row driven during this tick. */
+    uint8 repeat_key;                                   /* Brief : Key to be repeated, @Ref : ECU_KEYPAD_NO_KEY. */
+    uint8 repeat_scans;                                 /* Brief : Full scans left to the next repeat event. */
+#if KEYPAD_WAKEUP_CFG==CONFIG_ENABLE
+    volatile uint8 idle;                                /* Brief : (STD_ON) while waiting for the wake up interrupt. */
+#endif
+}keypad_scanner_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -53,6 +132,87 @@ Std_ReturnType keypad_initialize(const keypad_t *_keypad_obj);
  *          (E_NOT_OK) : The function has issue while performing this action.
  */
 Std_ReturnType keypad_get_value(const keypad_t *_keypad_obj, uint8 *value);
+
+/*
+ * @Brief              : To get the oldest KeyPad event.
+ * @Param fifo         : Pointer to the KeyPad events FIFO.
+ * @Param event        : Pointer to the event, its type is KEYPAD_EVENT_NONE if there is no event.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_get_event(keypad_event_fifo_t *fifo, keypad_event_t *event);
+
+#if KEYPAD_SCANNER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the KeyPad pins and the scanner state, the first row is driven.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_scanner_initialize(const keypad_t *_keypad_obj, keypad_scanner_t *scanner);
+
+/*
+ * @Brief              : To scan one KeyPad row, called every tick from a timer interrupt or the main loop.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : The driven row is read on the next tick, so the tick period is the settling time.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_scanner_tick(const keypad_t *_keypad_obj, keypad_scanner_t *scanner);
+#endif
+
+#if KEYPAD_ANALOG_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the analog KeyPad scanner state and start the first conversion.
+ * @Param _keypad_obj  : Pointer to the analog KeyPad configurations.
+ * @Param scanner      : Pointer to the analog KeyPad scanner state.
+ * @Note               : The ADC module has to be initialized before.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_analog_initialize(const keypad_analog_t *_keypad_obj, keypad_analog_scanner_t *scanner);
+
+/*
+ * @Brief              : To classify the last conversion and start the next one, called every tick.
+ * @Param _keypad_obj  : Pointer to the analog KeyPad configurations.
+ * @Param scanner      : Pointer to the analog KeyPad scanner state.
+ * @Note               : Events are read with keypad_get_event, repeat times match a matrix KeyPad ticked as often.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_analog_tick(const keypad_analog_t *_keypad_obj, keypad_analog_scanner_t *scanner);
+#endif
+
+#if (KEYPAD_SCANNER_CFG==CONFIG_ENABLE) && (KEYPAD_WAKEUP_CFG==CONFIG_ENABLE)
+/*
+ * @Brief              : Initialize the KeyPad scanner in wake up mode, the columns have to be on RB4 to RB7.
+ * @Param _keypad_obj  : Pointer to the KeyPad module configurations.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : Only one KeyPad can use the wake up mode, keypad_scanner_tick returns at once while idle.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_wakeup_initialize(const keypad_t *_keypad_obj, keypad_scanner_t *scanner);
+
+/*
+ * @Brief              : To put the MCU to sleep if the KeyPad is idle and all its events are read.
+ * @Param scanner      : Pointer to the KeyPad scanner state.
+ * @Note               : The MCU wakes up on the first key press. The idle check and SLEEP run with the
+ *                       global interrupts disabled, the key press interrupt is served after the wake up.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType keypad_wakeup_sleep(const keypad_scanner_t *scanner);
+#endif
 /***********************************************************************/
 #endif	/* ECU_KEYPAD_H */
 
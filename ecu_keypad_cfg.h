@@ -14,7 +14,35 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macro to enable the KeyPad tick driven scanner.
+ * @Note  : The scanner drives one row for each tick and debounces every key on its own.
+ */
+#define KEYPAD_SCANNER_CFG              CONFIG_ENABLE
 
+/* 
+ * @Brief : Macro to enable the KeyPad interrupt on change wake up mode.
+ * @Note  : The columns have to be on RB4 to RB7, all rows are driven while idle and the 
+ *          scanner runs only from the first column change until all keys are released.
+ */
+#define KEYPAD_WAKEUP_CFG               CONFIG_ENABLE
+/* @Brief : Macro for the KeyPad wake up RBx interrupt priority. */
+#define KEYPAD_WAKEUP_PRIORITY          INTERRUPT_LOW_PRIORITY
+
+/* 
+ * @Brief : Macro to enable the resistor ladder analog KeyPad on one ADC channel.
+ * @Note  : Every key gives its own voltage, one conversion is started each tick.
+ */
+#define KEYPAD_ANALOG_CFG               CONFIG_ENABLE
+
+/* @Brief : Macro for number of equal samples needed to accept a key change (one sample for each full scan). */
+#define KEYPAD_DEBOUNCE_SAMPLES         3
+/* @Brief : Macro for number of full scans a key is held before the first repeat event. */
+#define KEYPAD_REPEAT_DELAY_SCANS       125
+/* @Brief : Macro for number of full scans between repeat events. */
+#define KEYPAD_REPEAT_RATE_SCANS        25
+/* @Brief : Macro for size of the KeyPad events FIFO. */
+#define KEYPAD_EVENT_FIFO_SIZE          8
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -17,6 +17,8 @@
 #include "7_Segment/ecu_seven_segment.h"
 #include "KeyPad/ecu_keypad.h"
 #include "Chr_LCD/ecu_chr_lcd.h"
+#include "Stepper_Motor/ecu_stepper_motor.h"
+#include "Zero_Cross/ecu_zero_cross.h"
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
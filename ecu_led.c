@@ -10,6 +10,87 @@
 #include "ecu_led.h"
 /***********************************************************************/
 
+/*****************Helper Functions Declarations-Section*****************/
+#if LED_PATTERN_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the half of one PWM step in gamma table units, to round the duty. */
+#define LED_PATTERN_DUTY_ROUND          128
+
+/* @Brief : Gamma 2.2 table from perceived brightness to PWM duty, 255 is full duty. */
+static const uint8 led_pattern_gamma[LED_PATTERN_LEVEL_FULL + 1] =
+{
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+};
+
+static const led_pattern_frame_t led_pattern_blink_frames[] =
+{
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_FULL, 50),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 50)
+};
+
+static const led_pattern_frame_t led_pattern_blink_code_frames[] =
+{
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_FULL, 20),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 30),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 150)
+};
+
+static const led_pattern_frame_t led_pattern_breathing_frames[] =
+{
+    LED_PATTERN_FADE(LED_PATTERN_LEVEL_OFF, LED_PATTERN_LEVEL_FULL, 150),
+    LED_PATTERN_FADE(LED_PATTERN_LEVEL_FULL, LED_PATTERN_LEVEL_OFF, 150),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 50)
+};
+
+static const led_pattern_frame_t led_pattern_heartbeat_frames[] =
+{
+    LED_PATTERN_FADE(LED_PATTERN_LEVEL_OFF, LED_PATTERN_LEVEL_FULL, 4),
+    LED_PATTERN_FADE(LED_PATTERN_LEVEL_FULL, LED_PATTERN_LEVEL_OFF, 10),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 8),
+    LED_PATTERN_FADE(LED_PATTERN_LEVEL_OFF, 180, 4),
+    LED_PATTERN_FADE(180, LED_PATTERN_LEVEL_OFF, 14),
+    LED_PATTERN_HOLD(LED_PATTERN_LEVEL_OFF, 80)
+};
+
+const led_pattern_t led_pattern_blink = {led_pattern_blink_frames, 2, 0};
+const led_pattern_t led_pattern_blink_code = {led_pattern_blink_code_frames, 3, 2};
+const led_pattern_t led_pattern_breathing = {led_pattern_breathing_frames, 3, 0};
+const led_pattern_t led_pattern_heartbeat = {led_pattern_heartbeat_frames, 6, 0};
+
+/*
+ * @Brief              : To load a frame of the LED pattern.
+ * @Param channel      : Pointer to the LED pattern state of the LED.
+ * @Param frame        : Frame index.
+ */
+static void led_pattern_load_frame(led_pattern_channel_t *channel, uint8 frame);
+
+/*
+ * @Brief              : To play one pattern tick of one LED and move it in the PWM step masks.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Param led_index    : LED index, also the PWM step of the tick.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType led_pattern_play(const led_pattern_engine_t *engine, led_pattern_state_t *state, uint8 led_index);
+#endif
+/***********************************************************************/
+
 /*****************Software Interfaces Functions-Section*****************/
 /*
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the LED OFF or ON.
@@ -98,4 +179,246 @@ Std_ReturnType led_turn_toggle(const led_t *led)
      }
     return ret;
 }
+
+#if LED_PATTERN_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the LEDs of the pattern engine OFF and clear its state.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_initialize(const led_pattern_engine_t *engine, led_pattern_state_t *state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INT;
+    uint8 l_port = ZERO_INT;
+    uint8 l_step = ZERO_INT;
+    if((NULL == engine) || (NULL == state) || (NULL == engine->leds) ||
+       (engine->leds_number > LED_PATTERN_CFG_MAX_LEDS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+        {
+            for(l_step = ZERO_INT; l_step < LED_PATTERN_PWM_STEPS; l_step++)
+            {
+                state->off_masks[l_step][l_port] = ZERO_INT;
+            }
+            state->on_masks[l_port] = ZERO_INT;
+            state->used_masks[l_port] = ZERO_INT;
+        }
+        for(l_index = ZERO_INT; l_index < engine->leds_number; l_index++)
+        {
+            state->channels[l_index].pattern = NULL;
+            state->channels[l_index].level = ZERO_INT;
+            state->channels[l_index].frame = ZERO_INT;
+            state->channels[l_index].frame_ticks = ZERO_INT;
+            state->channels[l_index].loops = ZERO_INT;
+            state->channels[l_index].loops_left = ZERO_INT;
+            state->channels[l_index].duty = ZERO_INT;
+            state->used_masks[engine->leds[l_index].port_name] |= (uint8)(BIT_MASK << engine->leds[l_index].pin);
+            ret &= led_initialize(&(engine->leds[l_index]));
+        }
+        for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+        {
+            if(ZERO_INT != state->used_masks[l_port])
+            {
+                ret &= gpio_port_write_logic_masked(l_port, state->used_masks[l_port], GPIO_LOW);
+            }
+            else{/*****Nothing*****/}
+        }
+        state->pwm_step = ZERO_INT;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To start a pattern on one LED of the engine.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Param led_index    : LED index in the engine LEDs.
+ * @Param pattern      : Pointer to the pattern, NULL to turn the LED OFF.
+ * @Param loops        : Number of times the pattern loop frames are played, like the blink code.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_start(const led_pattern_engine_t *engine, led_pattern_state_t *state,
+                                 uint8 led_index, const led_pattern_t *pattern, uint8 loops)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    led_pattern_channel_t *l_channel = NULL;
+    if((NULL == engine) || (NULL == state) || (led_index >= engine->leds_number) ||
+       ((NULL != pattern) && ((NULL == pattern->frames) || (ZERO_INT == pattern->frames_number) ||
+                              (pattern->loop_frames > pattern->frames_number))))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_channel = &(state->channels[led_index]);
+        /* @Brief : The LED state is shared with the engine tick. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_channel->pattern = pattern;
+        l_channel->loops = loops;
+        l_channel->loops_left = loops;
+        if(NULL != pattern)
+        {
+            led_pattern_load_frame(l_channel, ZERO_INT);
+        }
+        else{/*****Nothing*****/}
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To run one PWM step and play one LED pattern, called from a periodic timer interrupt.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Note               : Every LED is played once per PWM period, the LED of the tick is the PWM step.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_tick(const led_pattern_engine_t *engine, led_pattern_state_t *state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_port = ZERO_INT;
+    uint8 l_step = ZERO_INT;
+    if((NULL == engine) || (NULL == state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        l_step = state->pwm_step;
+        for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+        {
+            if(ZERO_INT == l_step)
+            {
+                /* @Brief : PWM period start, every LED with a duty is turned ON. */
+                if(ZERO_INT != state->used_masks[l_port])
+                {
+                    ret &= gpio_port_write_logic_masked(l_port, state->used_masks[l_port], state->on_masks[l_port]);
+                }
+                else{/*****Nothing*****/}
+            }
+            else if(ZERO_INT != state->off_masks[l_step][l_port])
+            {
+                ret &= gpio_port_write_logic_masked(l_port, state->off_masks[l_step][l_port], GPIO_LOW);
+            }
+            else{/*****Nothing*****/}
+        }
+        if(l_step < engine->leds_number)
+        {
+            ret &= led_pattern_play(engine, state, l_step);
+        }
+        else{/*****Nothing*****/}
+        state->pwm_step = (l_step + 1) & (LED_PATTERN_PWM_STEPS - 1);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To load a frame of the LED pattern.
+ * @Param channel      : Pointer to the LED pattern state of the LED.
+ * @Param frame        : Frame index.
+ */
+static void led_pattern_load_frame(led_pattern_channel_t *channel, uint8 frame)
+{
+    channel->frame = frame;
+    channel->level = (uint16)channel->pattern->frames[frame].level << 8;
+    channel->frame_ticks = channel->pattern->frames[frame].duration;
+}
+
+/*
+ * @Brief              : To play one pattern tick of one LED and move it in the PWM step masks.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Param led_index    : LED index, also the PWM step of the tick.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType led_pattern_play(const led_pattern_engine_t *engine, led_pattern_state_t *state, uint8 led_index)
+{
+    Std_ReturnType ret = E_OK;
+    led_pattern_channel_t *l_channel = &(state->channels[led_index]);
+    const led_t *l_led = &(engine->leds[led_index]);
+    uint8 l_pin_mask = (uint8)(BIT_MASK << l_led->pin);
+    uint8 l_level = LED_PATTERN_LEVEL_OFF;
+    uint8 l_next = ZERO_INT;
+    uint8 l_duty = ZERO_INT;
+
+    if(NULL != l_channel->pattern)
+    {
+        l_level = (uint8)(l_channel->level >> 8);
+        l_channel->frame_ticks--;
+        if(ZERO_INT == l_channel->frame_ticks)
+        {
+            l_next = l_channel->frame + 1;
+            if((l_next == l_channel->pattern->loop_frames) && (l_channel->loops_left > 1))
+            {
+                l_channel->loops_left--;
+                l_next = ZERO_INT;
+            }
+            else if(l_next >= l_channel->pattern->frames_number)
+            {
+                l_channel->loops_left = l_channel->loops;
+                l_next = ZERO_INT;
+            }
+            else{/*****Nothing*****/}
+            led_pattern_load_frame(l_channel, l_next);
+        }
+        else
+        {
+            l_channel->level += (uint16)l_channel->pattern->frames[l_channel->frame].slope;
+        }
+    }
+    else{/*****Nothing*****/}
+
+    l_duty = (uint8)((((uint16)led_pattern_gamma[l_level] << LED_PATTERN_CFG_PWM_BITS) + LED_PATTERN_DUTY_ROUND) >> 8);
+    if(l_duty != l_channel->duty)
+    {
+        /* @Brief : Duty 0 is left out of the period start, full duty is never turned OFF. */
+        if(ZERO_INT == l_channel->duty)
+        {
+            state->on_masks[l_led->port_name] |= l_pin_mask;
+        }
+        else if(l_channel->duty < LED_PATTERN_PWM_STEPS)
+        {
+            state->off_masks[l_channel->duty][l_led->port_name] &= (uint8)(~l_pin_mask);
+        }
+        else{/*****Nothing*****/}
+        if(ZERO_INT == l_duty)
+        {
+            state->on_masks[l_led->port_name] &= (uint8)(~l_pin_mask);
+        }
+        else if(l_duty < LED_PATTERN_PWM_STEPS)
+        {
+            state->off_masks[l_duty][l_led->port_name] |= l_pin_mask;
+        }
+        else{/*****Nothing*****/}
+        /* @Brief : The OFF step of the new duty is already passed in this period. */
+        if(l_duty <= led_index)
+        {
+            ret = gpio_port_write_logic_masked(l_led->port_name, l_pin_mask, GPIO_LOW);
+        }
+        else{/*****Nothing*****/}
+        l_channel->duty = l_duty;
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
@@ -15,11 +15,24 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* @Brief : Macros for the LED pattern brightness, 0 is OFF and 255 is full brightness before the gamma. */
+#define LED_PATTERN_LEVEL_OFF           0
+#define LED_PATTERN_LEVEL_FULL          255
 
+/* @Brief : Macro for the software PWM steps of one pattern tick. */
+#define LED_PATTERN_PWM_STEPS           (1 << LED_PATTERN_CFG_PWM_BITS)
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
+/* @Brief : Macro function for a pattern frame holding _LEVEL for _TICKS pattern ticks. */
+#define LED_PATTERN_HOLD(_LEVEL, _TICKS)        {(_LEVEL), 0, (_TICKS)}
 
+/* @Brief : Macro function for a pattern frame fading from _FROM to _TO in _TICKS (2 and more) pattern ticks. */
+#define LED_PATTERN_FADE(_FROM, _TO, _TICKS)    {(_FROM), (sint16)((((sint32)(_TO) - (_FROM)) * 256) / (_TICKS)), (_TICKS)}
+
+#if (LED_PATTERN_CFG==CONFIG_ENABLE) && (LED_PATTERN_CFG_MAX_LEDS > LED_PATTERN_PWM_STEPS)
+#error "LED_PATTERN_CFG_MAX_LEDS must not be more than LED_PATTERN_PWM_STEPS."
+#endif
 /***********************************************************************/
 
 /********************Data Types Declarations-Section********************/
@@ -37,6 +50,61 @@ typedef struct
     uint8 pin : 3;          /* @Brief : LED Pin configuration. */
     uint8 led_status : 1;   /* @Brief : LED Status configuration. */
 }led_t;
+
+#if LED_PATTERN_CFG==CONFIG_ENABLE
+/* @Brief : LED pattern frame, placed in program memory. */
+typedef struct
+{
+    uint8 level;                         /* @Brief : Brightness at the start of the frame. */
+    sint16 slope;                        /* @Brief : Brightness change per pattern tick with 8 fraction bits. */
+    uint8 duration;                      /* @Brief : Frame length in pattern ticks. */
+}led_pattern_frame_t;
+
+/* 
+ * @Brief : LED pattern, placed in program memory.
+ * @Note  : The first loop_frames frames are played the number of times given at led_pattern_start,
+ *          then the other frames once, and the pattern starts over.
+ */
+typedef struct
+{
+    const led_pattern_frame_t *frames;   /* @Brief : Pattern frames. */
+    uint8 frames_number;                 /* @Brief : Number of frames. */
+    uint8 loop_frames;                   /* @Brief : Number of first frames repeated, 0 for none. */
+}led_pattern_t;
+
+/* @Brief : LED pattern engine configuration. */
+typedef struct
+{
+    const led_t *leds;                   /* @Brief : LEDs driven by the engine. */
+    uint8 leds_number;                   /* @Brief : Number of LEDs. */
+}led_pattern_engine_t;
+
+/* @Brief : LED pattern state of one LED. */
+typedef struct
+{
+    const led_pattern_t *pattern;        /* @Brief : Pattern played, NULL when the LED is OFF. */
+    uint16 level;                        /* @Brief : Brightness with 8 fraction bits. */
+    uint8 frame;                         /* @Brief : Frame played. */
+    uint8 frame_ticks;                   /* @Brief : Pattern ticks left in the frame. */
+    uint8 loops;                         /* @Brief : Number of times the loop frames are played. */
+    uint8 loops_left;                    /* @Brief : Loop frames plays left. */
+    uint8 duty;                          /* @Brief : Software PWM duty in PWM steps. */
+}led_pattern_channel_t;
+
+/* 
+ * @Brief : LED pattern engine state.
+ * @Note  : The PWM keeps one port mask of the LEDs turning OFF at every PWM step, so a tick writes
+ *          the ports and plays one LED whatever the number of LEDs.
+ */
+typedef struct
+{
+    led_pattern_channel_t channels[LED_PATTERN_CFG_MAX_LEDS];         /* @Brief : State of every LED. */
+    uint8 off_masks[LED_PATTERN_PWM_STEPS][PORT_MAX_NUMBER];          /* @Brief : LEDs turning OFF at every PWM step. */
+    uint8 on_masks[PORT_MAX_NUMBER];                                  /* @Brief : LEDs turned ON at the PWM period start. */
+    uint8 used_masks[PORT_MAX_NUMBER];                                /* @Brief : LEDs of the engine. */
+    uint8 pwm_step;                                                   /* @Brief : PWM step of the tick. */
+}led_pattern_state_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -75,6 +143,49 @@ Std_ReturnType led_turn_off(const led_t *led);
  *          (E_NOT_OK) : The function has issue while performing this action.
  */
 Std_ReturnType led_turn_toggle(const led_t *led);
+
+#if LED_PATTERN_CFG==CONFIG_ENABLE
+/* @Brief : Built-in patterns, in 10 ms pattern ticks. */
+extern const led_pattern_t led_pattern_blink;      /* @Brief : 1 Hz blink. */
+extern const led_pattern_t led_pattern_blink_code; /* @Brief : Blink code, the code is the loops of led_pattern_start. */
+extern const led_pattern_t led_pattern_breathing;  /* @Brief : Slow fade in and fade out. */
+extern const led_pattern_t led_pattern_heartbeat;  /* @Brief : Double pulse every 1.2 s. */
+
+/*
+ * @Brief              : Initialize the LEDs of the pattern engine OFF and clear its state.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_initialize(const led_pattern_engine_t *engine, led_pattern_state_t *state);
+
+/*
+ * @Brief              : To start a pattern on one LED of the engine.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Param led_index    : LED index in the engine LEDs.
+ * @Param pattern      : Pointer to the pattern, NULL to turn the LED OFF.
+ * @Param loops        : Number of times the pattern loop frames are played, like the blink code.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_start(const led_pattern_engine_t *engine, led_pattern_state_t *state,
+                                 uint8 led_index, const led_pattern_t *pattern, uint8 loops);
+
+/*
+ * @Brief              : To run one PWM step and play one LED pattern, called from a periodic timer interrupt.
+ * @Param engine       : Pointer to the LED pattern engine configurations.
+ * @Param state        : Pointer to the LED pattern engine state.
+ * @Note               : Every LED is played once per PWM period, the LED of the tick is the PWM step.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType led_pattern_tick(const led_pattern_engine_t *engine, led_pattern_state_t *state);
+#endif
 /***********************************************************************/
 #endif	/* ECU_LED_H */
 
@@ -14,7 +14,18 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macro to enable the LED pattern engine (blink codes, breathing and heartbeat with PWM brightness).
+ * @Note  : led_pattern_tick is called from a periodic timer interrupt, one pattern tick lasts
+ *          LED_PATTERN_PWM_STEPS engine ticks, 3.2 kHz engine ticks give 10 ms pattern ticks.
+ */
+#define LED_PATTERN_CFG                 CONFIG_DISABLE
+
+/* @Brief : Macro for the bits of the software PWM brightness, 5 gives 32 brightness steps. */
+#define LED_PATTERN_CFG_PWM_BITS        5
 
+/* @Brief : Macro for the LEDs driven by one pattern engine, up to LED_PATTERN_PWM_STEPS. */
+#define LED_PATTERN_CFG_MAX_LEDS        8
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
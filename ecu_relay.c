@@ -10,6 +10,29 @@
 #include "ecu_relay.h"
 /***********************************************************************/
 
+/*****************Helper Functions Declarations-Section*****************/
+#if RELAY_ECONOMIZER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To convert a time in ms to economizer ticks.
+ * @Param _time        : Time in ms.
+ * @Return Time in ticks, up to 0xFFFF.
+ */
+static uint16 relay_economizer_ticks(uint16 _time);
+
+/*
+ * @Brief              : To write the Relay pin when its logic changes.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _logic       : Relay pin logic.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType relay_economizer_drive(const relay_economizer_t *_economizer, relay_economizer_state_t *_state,
+                                             uint8 _logic);
+#endif
+/***********************************************************************/
+
 /*****************Software Interfaces Functions-Section*****************/
 /*
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the Relay OFF or ON.
@@ -76,4 +99,203 @@ Std_ReturnType relay_turn_off(const relay_t *_relay)
     }
     return ret;
 }
+
+#if RELAY_ECONOMIZER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the Relay pin OFF and the coil economizer state.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_initialize(const relay_economizer_t *_economizer, relay_economizer_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _economizer) || (NULL == _state) || (NULL == _economizer->relay) ||
+       (_economizer->hold_duty > RELAY_ECONOMIZER_CFG_PWM_STEPS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->stats.operations = ZERO_INT;
+        _state->stats.on_seconds = ZERO_INT;
+        _state->on_ticks = ZERO_INT;
+        _state->pull_in_ticks = relay_economizer_ticks(_economizer->pull_in_time);
+        _state->min_on_ticks = relay_economizer_ticks(_economizer->min_on_time);
+        _state->min_off_ticks = relay_economizer_ticks(_economizer->min_off_time);
+        /* @Brief : The Relay may be switched ON at the first tick. */
+        _state->switch_ticks = 0xFFFF;
+        _state->requested = RELAY_STATUS_OFF;
+        _state->coil = RELAY_COIL_OFF;
+        _state->pwm_step = ZERO_INT;
+        _state->coil_logic = GPIO_LOW;
+        ret = relay_initialize(_economizer->relay);
+        ret &= relay_turn_off(_economizer->relay);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To request the Relay ON or OFF, the tick switches it once the minimum time is over.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _status      : Relay status requested @Ref : RELAY_STATUS_x.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_request(relay_economizer_state_t *_state, uint8 _status)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _state) || (_status > RELAY_STATUS_ON))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->requested = _status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read the Relay switching statistics.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _stats       : Pointer to the statistics copy.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_get_stats(relay_economizer_state_t *_state, relay_economizer_stats_t *_stats)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _state) || (NULL == _stats))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : The 32-Bit counters are updated by the tick. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _stats->operations = _state->stats.operations;
+        _stats->on_seconds = _state->stats.on_seconds;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To drive the Relay coil for one tick, called from a periodic timer interrupt.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_tick(const relay_economizer_t *_economizer, relay_economizer_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _economizer) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        if(_state->switch_ticks < 0xFFFF)
+        {
+            _state->switch_ticks++;
+        }
+        else{/*****Nothing*****/}
+        _state->pwm_step++;
+        if(_state->pwm_step >= RELAY_ECONOMIZER_CFG_PWM_STEPS)
+        {
+            _state->pwm_step = ZERO_INT;
+        }
+        else{/*****Nothing*****/}
+
+        if(RELAY_COIL_OFF == _state->coil)
+        {
+            if((RELAY_STATUS_ON == _state->requested) && (_state->switch_ticks >= _state->min_off_ticks))
+            {
+                _state->coil = RELAY_COIL_PULL_IN;
+                _state->switch_ticks = ZERO_INT;
+                _state->stats.operations++;
+                ret = relay_economizer_drive(_economizer, _state, GPIO_HIGH);
+            }
+            else{/*****Nothing*****/}
+        }
+        else
+        {
+            _state->on_ticks++;
+            if(_state->on_ticks >= RELAY_ECONOMIZER_CFG_TICK_FREQUENCY)
+            {
+                _state->on_ticks = ZERO_INT;
+                _state->stats.on_seconds++;
+            }
+            else{/*****Nothing*****/}
+
+            if((RELAY_STATUS_OFF == _state->requested) && (_state->switch_ticks >= _state->min_on_ticks))
+            {
+                _state->coil = RELAY_COIL_OFF;
+                _state->switch_ticks = ZERO_INT;
+                ret = relay_economizer_drive(_economizer, _state, GPIO_LOW);
+            }
+            else if(RELAY_COIL_PULL_IN == _state->coil)
+            {
+                if(_state->switch_ticks >= _state->pull_in_ticks)
+                {
+                    _state->coil = RELAY_COIL_HOLD;
+                }
+                else{/*****Nothing*****/}
+            }
+            else
+            {
+                /* @Brief : The pulled in armature holds with a fraction of the coil current. */
+                ret = relay_economizer_drive(_economizer, _state,
+                                             (_state->pwm_step < _economizer->hold_duty) ? GPIO_HIGH : GPIO_LOW);
+            }
+        }
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To convert a time in ms to economizer ticks.
+ * @Param _time        : Time in ms.
+ * @Return Time in ticks, up to 0xFFFF.
+ */
+static uint16 relay_economizer_ticks(uint16 _time)
+{
+    uint32 l_ticks = ((uint32)_time * RELAY_ECONOMIZER_CFG_TICK_FREQUENCY) / 1000UL;
+    return (l_ticks > 0xFFFFUL) ? 0xFFFF : (uint16)l_ticks;
+}
+
+/*
+ * @Brief              : To write the Relay pin when its logic changes.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _logic       : Relay pin logic.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType relay_economizer_drive(const relay_economizer_t *_economizer, relay_economizer_state_t *_state,
+                                             uint8 _logic)
+{
+    Std_ReturnType ret = E_OK;
+    if(_logic != _state->coil_logic)
+    {
+        _state->coil_logic = _logic;
+        ret = (GPIO_HIGH == _logic) ? relay_turn_on(_economizer->relay) : relay_turn_off(_economizer->relay);
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
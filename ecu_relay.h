@@ -19,6 +19,11 @@
 #define RELAY_STATUS_ON 0x01U
 /* Brief : Relay Status Off configuration. */
 #define RELAY_STATUS_OFF 0x00U
+
+/* @Brief : Macros for the Relay coil drive of the economizer. */
+#define RELAY_COIL_OFF     0x00U
+#define RELAY_COIL_PULL_IN 0x01U
+#define RELAY_COIL_HOLD    0x02U
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -33,6 +38,40 @@ typedef struct
     uint8 relay_pin : 3;        /* Brief : Relay Pin configuration. */
     uint8 relay_status :1;      /* Brief : Relay Status configuration. */
 }relay_t;
+
+#if RELAY_ECONOMIZER_CFG==CONFIG_ENABLE
+/* @Brief : Relay coil economizer configuration, times in ms. */
+typedef struct
+{
+    const relay_t *relay;                /* @Brief : Relay driven. */
+    uint16 pull_in_time;                 /* @Brief : Full drive time after the Relay is turned ON. */
+    uint16 min_on_time;                  /* @Brief : Shortest ON time, a sooner OFF request waits. */
+    uint16 min_off_time;                 /* @Brief : Shortest OFF time, a sooner ON request waits. */
+    uint8 hold_duty;                     /* @Brief : Hold ON ticks out of RELAY_ECONOMIZER_CFG_PWM_STEPS. */
+}relay_economizer_t;
+
+/* @Brief : Relay coil economizer switching statistics. */
+typedef struct
+{
+    uint32 operations;                   /* @Brief : Number of times the Relay was pulled in. */
+    uint32 on_seconds;                   /* @Brief : Accumulated ON time in seconds. */
+}relay_economizer_stats_t;
+
+/* @Brief : Relay coil economizer state. */
+typedef struct
+{
+    volatile relay_economizer_stats_t stats; /* @Brief : Switching statistics. */
+    uint16 on_ticks;                     /* @Brief : ON ticks not yet counted in the ON seconds. */
+    uint16 switch_ticks;                 /* @Brief : Ticks since the last switch, saturates at 0xFFFF. */
+    uint16 pull_in_ticks;                /* @Brief : Pull-in time in ticks, computed at initialize. */
+    uint16 min_on_ticks;                 /* @Brief : Shortest ON time in ticks, computed at initialize. */
+    uint16 min_off_ticks;                /* @Brief : Shortest OFF time in ticks, computed at initialize. */
+    volatile uint8 requested;            /* @Brief : Relay status requested @Ref : RELAY_STATUS_x. */
+    volatile uint8 coil;                 /* @Brief : Relay coil drive @Ref : RELAY_COIL_x. */
+    uint8 pwm_step;                      /* @Brief : Hold PWM step of the tick. */
+    uint8 coil_logic;                    /* @Brief : Relay pin logic last written. */
+}relay_economizer_state_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -62,6 +101,48 @@ Std_ReturnType relay_turn_on(const relay_t *_relay);
  *          (E_NOT_OK) : The function has issue while performing this action.
  */
 Std_ReturnType relay_turn_off(const relay_t *_relay);
+
+#if RELAY_ECONOMIZER_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the Relay pin OFF and the coil economizer state.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_initialize(const relay_economizer_t *_economizer, relay_economizer_state_t *_state);
+
+/*
+ * @Brief              : To request the Relay ON or OFF, the tick switches it once the minimum time is over.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _status      : Relay status requested @Ref : RELAY_STATUS_x.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_request(relay_economizer_state_t *_state, uint8 _status);
+
+/*
+ * @Brief              : To read the Relay switching statistics.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Param _stats       : Pointer to the statistics copy.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_get_stats(relay_economizer_state_t *_state, relay_economizer_stats_t *_stats);
+
+/*
+ * @Brief              : To drive the Relay coil for one tick, called from a periodic timer interrupt.
+ * @Param _economizer  : Pointer to the Relay coil economizer configurations.
+ * @Param _state       : Pointer to the Relay coil economizer state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType relay_economizer_tick(const relay_economizer_t *_economizer, relay_economizer_state_t *_state);
+#endif
 /***********************************************************************/
 #endif	/* ECU_RELAY_H */
 
@@ -14,7 +14,17 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macro to enable the Relay coil economizer (full drive pull-in, then PWM hold).
+ * @Note  : relay_economizer_tick is called from a periodic timer interrupt at RELAY_ECONOMIZER_CFG_TICK_FREQUENCY.
+ */
+#define RELAY_ECONOMIZER_CFG                CONFIG_DISABLE
+
+/* @Brief : Macro for the relay_economizer_tick calls per second. */
+#define RELAY_ECONOMIZER_CFG_TICK_FREQUENCY 4000UL
 
+/* @Brief : Macro for the ticks of one hold PWM period, 8 gives a 500 Hz hold PWM at 4 kHz ticks. */
+#define RELAY_ECONOMIZER_CFG_PWM_STEPS      8
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -10,6 +10,19 @@
 #include "ecu_seven_segment.h"
 /***********************************************************************/
 
+/*****************Helper Functions Declarations-Section*****************/
+#if SEGMENT_MUX_CFG==CONFIG_ENABLE
+/*
+ * @Brief : Seven Segment segments of the hexadecimal digits, bit 0 is segment a.
+ */
+static const uint8 segment_mux_digits_lut[16] =
+{
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+    0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71
+};
+#endif
+/***********************************************************************/
+
 /*****************Software Interfaces Functions-Section*****************/
 /*
  * @Brief              : Initialize the assigned pin to be OUTPUT and turn the Seven Segment OFF or ON.
@@ -59,4 +72,181 @@ Std_ReturnType seven_segment_write_number(const segment_t *seg, uint8 number)
     }   
     return ret;
 } 
+
+#if SEGMENT_MUX_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the digits pins and the segments port of the multiplexed Seven Segment display.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_initialize(const segment_mux_t *mux, segment_mux_state_t *state)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_digit_counter = ZERO_INT;
+    pin_config_t l_digit_pin;
+    if((NULL == mux) || (NULL == state) || (ZERO_INT == mux->digits_number) || (mux->digits_number > SEGMENT_MUX_MAX_DIGITS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_digit_counter = ZERO_INT; l_digit_counter < mux->digits_number; l_digit_counter++)
+        {
+            /* @Brief : All digits start OFF. */
+            l_digit_pin = mux->digits_pins[l_digit_counter];
+            l_digit_pin.direction = GPIO_DIRECTION_OUTPUT;
+            l_digit_pin.logic = !(mux->digit_on_logic);
+            ret = gpio_pin_intialize(&l_digit_pin);
+            state->digits_buffer[l_digit_counter] = SEGMENT_MUX_BLANK;
+        }
+        ret = gpio_port_direction_intialize(mux->segments_port, 0x00);
+        ret = gpio_port_write_logic(mux->segments_port, (SEGMENT_COMMON_ANODE == mux->segment_type) ? 0xFF : 0x00);
+        state->brightness = SEGMENT_MUX_BRIGHTNESS_LEVELS;
+        state->active_digit = ZERO_INT;
+        state->digit_tick = ZERO_INT;
+    }   
+    return ret;
+}
+
+/*
+ * @Brief              : To write a decimal number to the digits buffer, right aligned with leading zeros blanked.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param number
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_write_number(const segment_mux_t *mux, segment_mux_state_t *state, uint16 number)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_digit_counter = ZERO_INT;
+    if((NULL == mux) || (NULL == state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_digit_counter = mux->digits_number; l_digit_counter > ZERO_INT; l_digit_counter--)
+        {
+            if((ZERO_INT == number) && (l_digit_counter != mux->digits_number))
+            {
+                state->digits_buffer[l_digit_counter - 1] = SEGMENT_MUX_BLANK;
+            }
+            else
+            {
+                state->digits_buffer[l_digit_counter - 1] = segment_mux_digits_lut[number % 10];
+            }
+            number /= 10;
+        }
+    }   
+    return ret;
+}
+
+/*
+ * @Brief              : To write one hexadecimal digit to the digits buffer.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param digit        : Digit index, 0 for the left digit.
+ * @Param value        : Digit value from 0 to 15.
+ * @Param dot          : (STD_ON) to turn the digit dot ON.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_write_digit(segment_mux_state_t *state, uint8 digit, uint8 value, uint8 dot)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == state) || (digit >= SEGMENT_MUX_MAX_DIGITS) || (value > 15))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        state->digits_buffer[digit] = segment_mux_digits_lut[value] | ((STD_ON == dot) ? SEGMENT_MUX_DP_MASK : 0x00);
+    }   
+    return ret;
+}
+
+/*
+ * @Brief              : To set the multiplexed Seven Segment display brightness.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param brightness   : ON ticks of every digit, 0 (OFF) to SEGMENT_MUX_BRIGHTNESS_LEVELS (full brightness).
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_set_brightness(segment_mux_state_t *state, uint8 brightness)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == state) || (brightness > SEGMENT_MUX_BRIGHTNESS_LEVELS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        state->brightness = brightness;
+    }   
+    return ret;
+}
+
+/*
+ * @Brief              : To refresh the multiplexed Seven Segment display, called from a periodic timer interrupt.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_tick(const segment_mux_t *mux, segment_mux_state_t *state)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_segments = ZERO_INT;
+    if((NULL == mux) || (NULL == state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(ZERO_INT == state->digit_tick)
+        {
+            /* @Brief : Turn the old digit OFF before the segments change to avoid ghosting. */
+            ret = gpio_pin_write_logic(&(mux->digits_pins[state->active_digit]), !(mux->digit_on_logic));
+            state->active_digit++;
+            if(state->active_digit >= mux->digits_number)
+            {
+                state->active_digit = ZERO_INT;
+            }
+            else{/*****Nothing*****/}
+            l_segments = state->digits_buffer[state->active_digit];
+            if(SEGMENT_COMMON_ANODE == mux->segment_type)
+            {
+                l_segments = ~l_segments;
+            }
+            else{/*****Nothing*****/}
+            ret = gpio_port_write_logic(mux->segments_port, l_segments);
+            if(ZERO_INT != state->brightness)
+            {
+                ret = gpio_pin_write_logic(&(mux->digits_pins[state->active_digit]), mux->digit_on_logic);
+            }
+            else{/*****Nothing*****/}
+        }
+        else if(state->digit_tick == state->brightness)
+        {
+            /* @Brief : End of the digit ON time. */
+            ret = gpio_pin_write_logic(&(mux->digits_pins[state->active_digit]), !(mux->digit_on_logic));
+        }
+        else{/*****Nothing*****/}
+        state->digit_tick++;
+        if(SEGMENT_MUX_BRIGHTNESS_LEVELS == state->digit_tick)
+        {
+            state->digit_tick = ZERO_INT;
+        }
+        else{/*****Nothing*****/}
+    }   
+    return ret;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
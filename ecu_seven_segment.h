@@ -20,6 +20,10 @@
 #define SEGMENT_PIN1 1
 #define SEGMENT_PIN2 2
 #define SEGMENT_PIN3 3
+
+/* @Brief : Macros for the multiplexed Seven Segment display segments bits (a to g then dp). */
+#define SEGMENT_MUX_DP_MASK     0x80
+#define SEGMENT_MUX_BLANK       0x00
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -40,6 +44,30 @@ typedef struct
     pin_config_t segment_pins[4];   /* @Brief : Seven Segment pins configuration. */
     segment_type_t segment_type;    /* @Brief : Seven Segment Anode or Cathode selection configuration. */
 }segment_t;
+
+#if SEGMENT_MUX_CFG==CONFIG_ENABLE
+/* 
+ * @Brief : Multiplexed Seven Segment display configuration.
+ * @Note  : Segments a to g and dp are bits 0 to 7 of one port, so a digit is written with one latch update.
+ */
+typedef struct
+{
+    pin_config_t digits_pins[SEGMENT_MUX_MAX_DIGITS];   /* @Brief : Digits common pins configuration, first pin is the left digit. */
+    port_index_t segments_port;                         /* @Brief : Segments port @Ref : port_index_t. */
+    segment_type_t segment_type;                        /* @Brief : Seven Segment Anode or Cathode selection configuration. */
+    uint8 digits_number;                                /* @Brief : Number of digits. */
+    uint8 digit_on_logic;                               /* @Brief : Digit common pin logic to turn the digit ON @Ref : logic_t. */
+}segment_mux_t;
+
+/* @Brief : Multiplexed Seven Segment display state. */
+typedef struct
+{
+    volatile uint8 digits_buffer[SEGMENT_MUX_MAX_DIGITS];  /* @Brief : Segments of every digit, written by the application. */
+    volatile uint8 brightness;                             /* @Brief : ON ticks of every digit out of SEGMENT_MUX_BRIGHTNESS_LEVELS. */
+    uint8 active_digit;                                    /* @Brief : Digit being refreshed. */
+    uint8 digit_tick;                                      /* @Brief : Ticks since the active digit was turned ON. */
+}segment_mux_state_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -61,6 +89,61 @@ Std_ReturnType seven_segment_initialize(const segment_t *seg);
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
 Std_ReturnType seven_segment_write_number(const segment_t *seg, uint8 number);
+
+#if SEGMENT_MUX_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the digits pins and the segments port of the multiplexed Seven Segment display.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_initialize(const segment_mux_t *mux, segment_mux_state_t *state);
+
+/*
+ * @Brief              : To write a decimal number to the digits buffer, right aligned with leading zeros blanked.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param number
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_write_number(const segment_mux_t *mux, segment_mux_state_t *state, uint16 number);
+
+/*
+ * @Brief              : To write one hexadecimal digit to the digits buffer.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param digit        : Digit index, 0 for the left digit.
+ * @Param value        : Digit value from 0 to 15.
+ * @Param dot          : (STD_ON) to turn the digit dot ON.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_write_digit(segment_mux_state_t *state, uint8 digit, uint8 value, uint8 dot);
+
+/*
+ * @Brief              : To set the multiplexed Seven Segment display brightness.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Param brightness   : ON ticks of every digit, 0 (OFF) to SEGMENT_MUX_BRIGHTNESS_LEVELS (full brightness).
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_set_brightness(segment_mux_state_t *state, uint8 brightness);
+
+/*
+ * @Brief              : To refresh the multiplexed Seven Segment display, called from a periodic timer interrupt.
+ * @Param mux          : Pointer to the multiplexed Seven Segment display configurations.
+ * @Param state        : Pointer to the multiplexed Seven Segment display state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action. 
+ */
+Std_ReturnType seven_segment_mux_tick(const segment_mux_t *mux, segment_mux_state_t *state);
+#endif
 /***********************************************************************/
 #endif	/* ECU_SEVEN_SEGMENT_H */
 
@@ -14,7 +14,18 @@
 /***********************************************************************/
 
 /**********************Macro Declarations-Section***********************/
+/* 
+ * @Brief : Macro to enable the multiplexed Seven Segment display driver.
+ * @Note  : The display is refreshed from a timer interrupt, one digit for each 
+ *          SEGMENT_MUX_BRIGHTNESS_LEVELS ticks, so the tick rate is 
+ *          refresh rate * digits number * SEGMENT_MUX_BRIGHTNESS_LEVELS.
+ */
+#define SEGMENT_MUX_CFG                 CONFIG_ENABLE
 
+/* @Brief : Macro for the multiplexed Seven Segment display maximum number of digits. */
+#define SEGMENT_MUX_MAX_DIGITS          4
+/* @Brief : Macro for the multiplexed Seven Segment display number of brightness levels. */
+#define SEGMENT_MUX_BRIGHTNESS_LEVELS   4
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
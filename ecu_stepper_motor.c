@@ -0,0 +1,502 @@
+/*
+ * File     : ecu_stepper_motor.c
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 11:56 AM
+ */
+
+/**************************Includes-Section*****************************/
+#include "ecu_stepper_motor.h"
+/***********************************************************************/
+
+/*****************Helper Functions Declarations-Section*****************/
+#if STEPPER_MOTOR_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the queued moves ring index mask. */
+#define STEPPER_MOTOR_QUEUE_INDEX_MASK     (STEPPER_MOTOR_CFG_QUEUE_SIZE - 1)
+
+/*
+ * @Brief : Macro for the first step delay scale, 0.676 * sqrt(2) * timer frequency * 16 (sqrt(256)),
+ *          divided by the integer square root of 256 times the acceleration.
+ */
+#define STEPPER_MOTOR_FIRST_DELAY_SCALE    ((STEPPER_MOTOR_CFG_TIMER_FREQUENCY / 1000UL) * 956UL * 16UL)
+#define STEPPER_MOTOR_FIRST_DELAY_SHIFT    8
+
+/* @Brief : Macro for the step delay changes of 2 to the power of this shift and more that are divided, not subtracted. */
+#define STEPPER_MOTOR_SUBTRACT_SHIFT       3
+
+/*
+ * @Brief             : To compute the integer square root.
+ * @Param _value      : Value to take the square root of.
+ * @Return Integer square root rounded down.
+ */
+static uint16 stepper_motor_sqrt(uint32 _value);
+
+/*
+ * @Brief             : To compute the next step delay change (2 * step delay + remainder) / divisor.
+ * @Param _state      : Pointer to the Stepper Motor state, the remainder is kept for the next step.
+ * @Param _divisor    : 4 * ramp step + 1 while speeding up, 4 * steps left - 1 while slowing down.
+ * @Note              : Fast ramp steps have a change below 8 and subtract it out in a few loops,
+ *                      only slow steps with time to spare run the 32-Bit division.
+ * @Return Step delay change in timer ticks.
+ */
+static uint16 stepper_motor_delay_change(stepper_motor_state_t *_state, uint32 _divisor);
+
+/*
+ * @Brief             : To write the next step delay to CCPR1 or CCPR2 from the step interrupt.
+ * @Param _state      : Pointer to the Stepper Motor state.
+ * @Param _delay      : Step delay in timer ticks.
+ */
+static void stepper_motor_write_delay(const stepper_motor_state_t *_state, uint16 _delay);
+#endif
+/***********************************************************************/
+
+/*****************Software Interfaces Functions-Section*****************/
+#if STEPPER_MOTOR_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the Stepper Motor pins and state and compute its ramp delays.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Note               : The step timer CCP is initialized before by CCP_Init, its timer runs at
+ *                       STEPPER_MOTOR_CFG_TIMER_FREQUENCY and is used by this Stepper Motor only.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_initialize(const stepper_motor_t *_stepper, stepper_motor_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_first_delay = ZERO_INT;
+    uint32 l_min_delay = ZERO_INT;
+    if((NULL == _stepper) || (NULL == _state) || (NULL == _stepper->step_timer) ||
+       (ZERO_INT == _stepper->max_speed) || (ZERO_INT == _stepper->acceleration))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : c0 = 0.676 * F * sqrt(2 / acceleration), the ramp of the first step. */
+        l_first_delay = STEPPER_MOTOR_FIRST_DELAY_SCALE /
+                        stepper_motor_sqrt((uint32)_stepper->acceleration << STEPPER_MOTOR_FIRST_DELAY_SHIFT);
+        l_min_delay = STEPPER_MOTOR_CFG_TIMER_FREQUENCY / _stepper->max_speed;
+        if(l_min_delay < STEPPER_MOTOR_CFG_MIN_STEP_TICKS)
+        {
+            l_min_delay = STEPPER_MOTOR_CFG_MIN_STEP_TICKS;
+        }
+        else if(l_min_delay > 0xFFFFUL)
+        {
+            l_min_delay = 0xFFFFUL;
+        }
+        else{/*****Nothing*****/}
+        if(l_first_delay > 0xFFFFUL)
+        {
+            l_first_delay = 0xFFFFUL;
+        }
+        else{/*****Nothing*****/}
+
+        _state->moves_head = ZERO_INT;
+        _state->moves_count = ZERO_INT;
+        _state->position = ZERO_INT;
+        _state->steps_left = ZERO_INT;
+        _state->accel_steps = ZERO_INT;
+        _state->decel_steps = ZERO_INT;
+        _state->speed_index = ZERO_INT;
+        _state->delay_rest = ZERO_INT;
+        _state->direction = STEPPER_MOTOR_DIRECTION_FORWARD;
+        _state->decelerating = STD_IDLE;
+        _state->min_delay = (uint16)l_min_delay;
+        if(l_first_delay > l_min_delay)
+        {
+            _state->first_delay = (uint16)l_first_delay;
+            /* @Brief : Ramp steps to the cruise speed, speed squared / (2 * acceleration). */
+            _state->ramp_steps = ((uint32)_stepper->max_speed * _stepper->max_speed) /
+                                 ((uint32)_stepper->acceleration << 1);
+        }
+        else
+        {
+            /* @Brief : The cruise speed is reached from the first step, no ramp. */
+            _state->first_delay = (uint16)l_min_delay;
+            _state->ramp_steps = ZERO_INT;
+        }
+        _state->step_delay = _state->first_delay;
+
+        /* @Brief : The step interrupt writes the step pin latch and the compare register directly. */
+        _state->step_latch = lat_registers[_stepper->step_pin.port];
+        _state->step_mask = (uint8)(1 << _stepper->step_pin.pin);
+        _state->step_ccp_inst = _stepper->step_timer->ccp_inst;
+        ret = gpio_pin_intialize(&(_stepper->step_pin));
+        ret &= gpio_pin_write_logic(&(_stepper->step_pin), GPIO_LOW);
+        ret &= gpio_pin_intialize(&(_stepper->dir_pin));
+        /* @Brief : While idle the step interrupt comes every first step delay and looks for a queued move. */
+        ret &= CCP_Set_Compare_Mode_Value(_stepper->step_timer, _state->first_delay);
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To queue a move from stand still to stand still with a trapezoidal speed ramp.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param direction    : Move direction @Ref : STEPPER_MOTOR_DIRECTION_x.
+ * @Param steps        : Steps of the move.
+ * @Note               : Short moves get a triangular ramp, the move starts one first step delay
+ *                       after the running move ends.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or the queue is full.
+ */
+Std_ReturnType stepper_motor_queue_move(const stepper_motor_t *_stepper, stepper_motor_state_t *_state,
+                                        uint8 direction, uint16 steps)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    stepper_motor_move_t *l_move = NULL;
+    if((NULL == _stepper) || (NULL == _state) || (ZERO_INT == steps) ||
+       (direction > STEPPER_MOTOR_DIRECTION_REVERSE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : The queue is shared with the step interrupt. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        if(_state->moves_count < STEPPER_MOTOR_CFG_QUEUE_SIZE)
+        {
+            l_move = &(_state->moves[(_state->moves_head + _state->moves_count) & STEPPER_MOTOR_QUEUE_INDEX_MASK]);
+            l_move->steps = steps;
+            l_move->direction = direction;
+            /* @Brief : The first step has no delay update, the ramps share the other steps. */
+            if((uint32)(steps - 1) >= (_state->ramp_steps << 1))
+            {
+                l_move->accel_steps = (uint16)_state->ramp_steps;
+                l_move->decel_steps = (uint16)_state->ramp_steps;
+            }
+            else
+            {
+                l_move->accel_steps = (uint16)((steps - 1) >> 1);
+                l_move->decel_steps = (uint16)((steps - 1) - l_move->accel_steps);
+            }
+            _state->moves_count++;
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To drop the queued moves and slow the running move down to stand still.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_stop(stepper_motor_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    uint16 l_stop_steps = ZERO_INT;
+    if(NULL == _state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _state->moves_count = ZERO_INT;
+        if((ZERO_INT != _state->steps_left) && (STD_IDLE == _state->decelerating))
+        {
+            /* @Brief : Slowing down from ramp step n takes n steps. */
+            l_stop_steps = (ZERO_INT == _state->speed_index) ? 1 : _state->speed_index;
+            if(l_stop_steps < _state->steps_left)
+            {
+                _state->steps_left = l_stop_steps;
+                _state->decel_steps = l_stop_steps;
+            }
+            else{/*****Nothing*****/}
+        }
+        else{/*****Nothing*****/}
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read the Stepper Motor position.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param position     : Pointer to the position in steps.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_get_position(stepper_motor_state_t *_state, sint32 *position)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _state) || (NULL == position))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : The 32-Bit position is not read in one instruction. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *position = _state->position;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To set the Stepper Motor position, like after homing.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param position     : New position in steps.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or the motor moves.
+ */
+Std_ReturnType stepper_motor_set_position(stepper_motor_state_t *_state, sint32 position)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if(NULL == _state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        if((ZERO_INT == _state->steps_left) && (ZERO_INT == _state->moves_count))
+        {
+            _state->position = position;
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To check if the Stepper Motor is moving or has queued moves.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param busy         : Pointer to the status, STD_ACTIVE while moving.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_is_busy(stepper_motor_state_t *_state, uint8 *busy)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _state) || (NULL == busy))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *busy = ((ZERO_INT != _state->steps_left) || (ZERO_INT != _state->moves_count)) ? STD_ACTIVE : STD_IDLE;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To do one step and arm the next step delay, called from the step timer CCP interrupt.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Note               : Cruise steps only write the step pin latch, the special event trigger reloads
+ *                       the armed delay. Slow ramp steps divide and fast ramp steps subtract, so no
+ *                       sqrt and no float run here.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_isr(const stepper_motor_t *_stepper, stepper_motor_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_change = ZERO_INT;
+    stepper_motor_move_t *l_move = NULL;
+    if((NULL == _stepper) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+        if(ZERO_INT != _state->steps_left)
+        {
+            /* @Brief : The special event trigger restarted the timer at the match, the step is on time. */
+            *(_state->step_latch) |= _state->step_mask;
+            if(STEPPER_MOTOR_DIRECTION_FORWARD == _state->direction)
+            {
+                _state->position++;
+            }
+            else
+            {
+                _state->position--;
+            }
+            _state->steps_left--;
+
+            if((_state->steps_left > _state->decel_steps) && (_state->speed_index >= _state->accel_steps))
+            {
+                /* @Brief : Cruise step, the special event trigger reloads the armed delay. */
+            }
+            else
+            {
+                if(ZERO_INT == _state->steps_left)
+                {
+                    _state->step_delay = _state->first_delay;
+                }
+                else if(_state->steps_left <= _state->decel_steps)
+                {
+                    /* @Brief : Slowing down, c = c + (2 * c + rest) / (4 * steps left - 1). */
+                    if(STD_IDLE == _state->decelerating)
+                    {
+                        _state->decelerating = STD_ACTIVE;
+                        _state->delay_rest = ZERO_INT;
+                    }
+                    else{/*****Nothing*****/}
+                    l_change = stepper_motor_delay_change(_state, ((uint32)_state->steps_left << 2) - 1);
+                    if(l_change < (uint16)(_state->first_delay - _state->step_delay))
+                    {
+                        _state->step_delay += l_change;
+                    }
+                    else
+                    {
+                        _state->step_delay = _state->first_delay;
+                    }
+                    _state->speed_index = _state->steps_left;
+                }
+                else
+                {
+                    /* @Brief : Speeding up, c = c - (2 * c + rest) / (4 * n + 1). */
+                    _state->speed_index++;
+                    l_change = stepper_motor_delay_change(_state, ((uint32)_state->speed_index << 2) + 1);
+                    if(l_change < (uint16)(_state->step_delay - _state->min_delay))
+                    {
+                        _state->step_delay -= l_change;
+                    }
+                    else
+                    {
+                        _state->step_delay = _state->min_delay;
+                    }
+                }
+                stepper_motor_write_delay(_state, _state->step_delay);
+            }
+            *(_state->step_latch) &= (uint8)(~_state->step_mask);
+        }
+        else{/*****Nothing*****/}
+
+        if((ZERO_INT == _state->steps_left) && (ZERO_INT != _state->moves_count))
+        {
+            /* @Brief : The dir pin settles for one first step delay before the first step. */
+            l_move = &(_state->moves[_state->moves_head]);
+            _state->direction = l_move->direction;
+            _state->accel_steps = l_move->accel_steps;
+            _state->decel_steps = l_move->decel_steps;
+            _state->speed_index = ZERO_INT;
+            _state->delay_rest = ZERO_INT;
+            _state->decelerating = STD_IDLE;
+            _state->step_delay = _state->first_delay;
+            _state->steps_left = l_move->steps;
+            _state->moves_head = (_state->moves_head + 1) & STEPPER_MOTOR_QUEUE_INDEX_MASK;
+            _state->moves_count--;
+            ret &= gpio_pin_write_logic(&(_stepper->dir_pin), (logic_t)_state->direction);
+            ret &= CCP_Set_Compare_Mode_Value(_stepper->step_timer, _state->first_delay);
+        }
+        else{/*****Nothing*****/}
+    }
+    return ret;
+}
+
+/*
+ * @Brief             : To compute the integer square root.
+ * @Param _value      : Value to take the square root of.
+ * @Return Integer square root rounded down.
+ */
+static uint16 stepper_motor_sqrt(uint32 _value)
+{
+    uint32 l_root = ZERO_INT;
+    uint32 l_bit = (uint32)1 << 30;
+    while(l_bit > _value)
+    {
+        l_bit >>= 2;
+    }
+    while(ZERO_INT != l_bit)
+    {
+        if(_value >= (l_root + l_bit))
+        {
+            _value -= (l_root + l_bit);
+            l_root = (l_root >> 1) + l_bit;
+        }
+        else
+        {
+            l_root >>= 1;
+        }
+        l_bit >>= 2;
+    }
+    return (uint16)l_root;
+}
+
+/*
+ * @Brief             : To compute the next step delay change (2 * step delay + remainder) / divisor.
+ * @Param _state      : Pointer to the Stepper Motor state, the remainder is kept for the next step.
+ * @Param _divisor    : 4 * ramp step + 1 while speeding up, 4 * steps left - 1 while slowing down.
+ * @Note              : Fast ramp steps have a change below 8 and subtract it out in a few loops,
+ *                      only slow steps with time to spare run the 32-Bit division.
+ * @Return Step delay change in timer ticks.
+ */
+static uint16 stepper_motor_delay_change(stepper_motor_state_t *_state, uint32 _divisor)
+{
+    uint32 l_dividend = ((uint32)_state->step_delay << 1) + _state->delay_rest;
+    uint16 l_change = ZERO_INT;
+    if(l_dividend >= (_divisor << STEPPER_MOTOR_SUBTRACT_SHIFT))
+    {
+        l_change = (uint16)(l_dividend / _divisor);
+        _state->delay_rest = l_dividend - ((uint32)l_change * _divisor);
+    }
+    else
+    {
+        while(l_dividend >= _divisor)
+        {
+            l_dividend -= _divisor;
+            l_change++;
+        }
+        _state->delay_rest = l_dividend;
+    }
+    return l_change;
+}
+
+/*
+ * @Brief             : To write the next step delay to CCPR1 or CCPR2 from the step interrupt.
+ * @Param _state      : Pointer to the Stepper Motor state.
+ * @Param _delay      : Step delay in timer ticks.
+ */
+static void stepper_motor_write_delay(const stepper_motor_state_t *_state, uint16 _delay)
+{
+    if(CCP1_INST == _state->step_ccp_inst)
+    {
+        CCPR1L = (uint8)_delay;
+        CCPR1H = (uint8)(_delay >> 8);
+    }
+    else
+    {
+        CCPR2L = (uint8)_delay;
+        CCPR2H = (uint8)(_delay >> 8);
+    }
+}
+#endif
+/***********************************************************************/
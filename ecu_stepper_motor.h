@@ -0,0 +1,165 @@
+/*
+ * File     : ecu_stepper_motor.h
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 11:56 AM
+ */
+
+#ifndef ECU_STEPPER_MOTOR_H
+#define	ECU_STEPPER_MOTOR_H
+
+/**************************Includes-Section*****************************/
+#include "ecu_stepper_motor_cfg.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#if STEPPER_MOTOR_CFG==CONFIG_ENABLE
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+#endif
+/***********************************************************************/
+
+/**********************Macro Declarations-Section***********************/
+/* @Brief : Macros for Stepper Motor move directions, the dir pin logic of the move. */
+#define STEPPER_MOTOR_DIRECTION_FORWARD     0x00U
+#define STEPPER_MOTOR_DIRECTION_REVERSE     0x01U
+/***********************************************************************/
+
+/******************Macro Function Declarations-Section******************/
+#if (STEPPER_MOTOR_CFG==CONFIG_ENABLE) && (CCP1_CFG_SELECTED_MODE!=CCP_CFG_COMPARE_MODE_SELECTED) && \
+                                         (CCP2_CFG_SELECTED_MODE!=CCP_CFG_COMPARE_MODE_SELECTED)
+#error "STEPPER_MOTOR_CFG needs CCP1 or CCP2 in Compare mode."
+#endif
+
+#if (STEPPER_MOTOR_CFG==CONFIG_ENABLE) && (STEPPER_MOTOR_CFG_QUEUE_SIZE & (STEPPER_MOTOR_CFG_QUEUE_SIZE - 1))
+#error "STEPPER_MOTOR_CFG_QUEUE_SIZE must be a power of 2."
+#endif
+/***********************************************************************/
+
+/********************Data Types Declarations-Section********************/
+#if STEPPER_MOTOR_CFG==CONFIG_ENABLE
+/* @Brief : Stepper Motor step/dir driver configuration. */
+typedef struct
+{
+    const ccp_t *step_timer;             /* @Brief : CCP in Compare mode with the special event trigger timing the steps. */
+    pin_config_t step_pin;               /* @Brief : Driver step input, one pulse for each step. */
+    pin_config_t dir_pin;                /* @Brief : Driver direction input. */
+    uint16 max_speed;                    /* @Brief : Cruise speed in steps per second. */
+    uint16 acceleration;                 /* @Brief : Acceleration and deceleration in steps per second squared. */
+}stepper_motor_t;
+
+/* @Brief : Stepper Motor queued move, its ramp is planned when it is queued. */
+typedef struct
+{
+    uint16 steps;                        /* @Brief : Steps of the move. */
+    uint16 accel_steps;                  /* @Brief : Step delay updates while speeding up. */
+    uint16 decel_steps;                  /* @Brief : Last steps of the move while slowing down. */
+    uint8 direction;                     /* @Brief : Move direction @Ref : STEPPER_MOTOR_DIRECTION_x. */
+}stepper_motor_move_t;
+
+/* @Brief : Stepper Motor state, step delays in timer ticks. */
+typedef struct
+{
+    stepper_motor_move_t moves[STEPPER_MOTOR_CFG_QUEUE_SIZE]; /* @Brief : Queued moves ring. */
+    volatile uint8 moves_head;           /* @Brief : Index of the oldest queued move. */
+    volatile uint8 moves_count;          /* @Brief : Number of queued moves. */
+    volatile sint32 position;            /* @Brief : Steps done forward minus steps done in reverse. */
+    volatile uint16 steps_left;          /* @Brief : Steps left in the running move, 0 when idle. */
+    uint16 accel_steps;                  /* @Brief : Step delay updates of the running move speeding up. */
+    volatile uint16 decel_steps;         /* @Brief : Steps left when the running move starts slowing down. */
+    volatile uint16 speed_index;         /* @Brief : Ramp step reached, 0 at stand still. */
+    uint16 step_delay;                   /* @Brief : Delay armed before the next step. */
+    uint32 delay_rest;                   /* @Brief : Remainder of the last step delay division. */
+    uint16 first_delay;                  /* @Brief : Delay before the first step of a move, computed at initialize. */
+    uint16 min_delay;                    /* @Brief : Cruise step delay, computed at initialize. */
+    volatile uint8 *step_latch;          /* @Brief : Step pin data latch register, set at initialize. */
+    uint8 step_mask;                     /* @Brief : Step pin Bit-Mask in its data latch register, set at initialize. */
+    uint8 step_ccp_inst;                 /* @Brief : Step timer CCP instance, set at initialize. */
+    uint32 ramp_steps;                   /* @Brief : Step delay updates from stand still to the cruise speed. */
+    uint8 direction;                     /* @Brief : Direction of the running move. */
+    volatile uint8 decelerating;         /* @Brief : STD_ACTIVE once the running move slows down. */
+}stepper_motor_state_t;
+#endif
+/***********************************************************************/
+
+/**********Software Interfaces Functions Declarations-Section***********/
+#if STEPPER_MOTOR_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the Stepper Motor pins and state and compute its ramp delays.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Note               : The step timer CCP is initialized before by CCP_Init, its timer runs at
+ *                       STEPPER_MOTOR_CFG_TIMER_FREQUENCY and is used by this Stepper Motor only.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_initialize(const stepper_motor_t *_stepper, stepper_motor_state_t *_state);
+
+/*
+ * @Brief              : To queue a move from stand still to stand still with a trapezoidal speed ramp.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param direction    : Move direction @Ref : STEPPER_MOTOR_DIRECTION_x.
+ * @Param steps        : Steps of the move.
+ * @Note               : Short moves get a triangular ramp, the move starts one first step delay
+ *                       after the running move ends.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or the queue is full.
+ */
+Std_ReturnType stepper_motor_queue_move(const stepper_motor_t *_stepper, stepper_motor_state_t *_state,
+                                        uint8 direction, uint16 steps);
+
+/*
+ * @Brief              : To drop the queued moves and slow the running move down to stand still.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_stop(stepper_motor_state_t *_state);
+
+/*
+ * @Brief              : To read the Stepper Motor position.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param position     : Pointer to the position in steps.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_get_position(stepper_motor_state_t *_state, sint32 *position);
+
+/*
+ * @Brief              : To set the Stepper Motor position, like after homing.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param position     : New position in steps.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action, or the motor moves.
+ */
+Std_ReturnType stepper_motor_set_position(stepper_motor_state_t *_state, sint32 position);
+
+/*
+ * @Brief              : To check if the Stepper Motor is moving or has queued moves.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Param busy         : Pointer to the status, STD_ACTIVE while moving.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_is_busy(stepper_motor_state_t *_state, uint8 *busy);
+
+/*
+ * @Brief              : To do one step and arm the next step delay, called from the step timer CCP interrupt.
+ * @Param _stepper     : Pointer to the Stepper Motor configurations.
+ * @Param _state       : Pointer to the Stepper Motor state.
+ * @Note               : Cruise steps only write the step pin latch, the special event trigger reloads
+ *                       the armed delay. Slow ramp steps divide and fast ramp steps subtract, so no
+ *                       sqrt and no float run here.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType stepper_motor_isr(const stepper_motor_t *_stepper, stepper_motor_state_t *_state);
+#endif
+/***********************************************************************/
+#endif	/* ECU_STEPPER_MOTOR_H */
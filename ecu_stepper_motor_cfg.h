@@ -0,0 +1,55 @@
+/*
+ * File     : ecu_stepper_motor_cfg.h
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 11:56 AM
+ */
+
+#ifndef ECU_STEPPER_MOTOR_CFG_H
+#define	ECU_STEPPER_MOTOR_CFG_H
+
+/**************************Includes-Section*****************************/
+
+/***********************************************************************/
+
+/**********************Macro Declarations-Section***********************/
+/*
+ * @Brief : Macro to enable the step/dir Stepper Motor driver.
+ * @Note  : Needs a CCP in Compare mode with the special event trigger (CCP_COMPARE_MODE_GEN_EVENT)
+ *          on Timer1 or Timer3, the special event trigger resets the timer at every step.
+ *          With CCP2 the special event trigger also starts an A/D conversion at every step when
+ *          the A/D module is on, use CCP1 when the A/D converter is used by the application.
+ */
+#define STEPPER_MOTOR_CFG                   CONFIG_DISABLE
+
+/* @Brief : Macro for the queued moves of one Stepper Motor, power of 2. */
+#define STEPPER_MOTOR_CFG_QUEUE_SIZE        4
+
+/* @Brief : Macro for the Timer1 or Timer3 ticks per second, Fosc / 4 with pre-scaler 1:1. */
+#define STEPPER_MOTOR_CFG_TIMER_FREQUENCY   2000000UL
+
+/*
+ * @Brief : Macro for the shortest step delay in timer ticks (4 kHz), one tick is one instruction cycle at 1:1.
+ * @Note  : About 160 instruction cycles run before stepper_motor_isr : 50 for the context save and restore,
+ *          80 for the interrupt manager flag checks ahead of CCP1 and 30 for the CCP callback. A cruise
+ *          step adds about 60 (step pin latch writes only) and a fast ramp step about 140 (subtract loops
+ *          and CCPRx write), so about 300 cycles at full speed. 500 ticks leave about 40 percent of the CPU
+ *          to the application. Rates above 10 kHz (200 cycles) do not fit behind the shared interrupt
+ *          manager at 8 MHz.
+ */
+#define STEPPER_MOTOR_CFG_MIN_STEP_TICKS    500UL
+/***********************************************************************/
+
+/******************Macro Function Declarations-Section******************/
+
+/***********************************************************************/
+
+/********************Data Types Declarations-Section********************/
+
+/***********************************************************************/
+
+/**********Software Interfaces Functions Declarations-Section***********/
+
+/***********************************************************************/
+#endif	/* ECU_STEPPER_MOTOR_CFG_H */
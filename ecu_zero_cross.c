@@ -0,0 +1,277 @@
+/*
+ * File     : ecu_zero_cross.c
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 12:02 PM
+ */
+
+/**************************Includes-Section*****************************/
+#include "ecu_zero_cross.h"
+/***********************************************************************/
+
+/*****************Helper Functions Declarations-Section*****************/
+#if ZERO_CROSS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : To queue the relay switch and triac firing events of the crossing.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _now         : Timebase time of the INT0 timestamp.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType zero_cross_schedule(const zero_cross_t *_zero_cross, zero_cross_state_t *_state, uint32 _now);
+#endif
+/***********************************************************************/
+
+/*****************Software Interfaces Functions-Section*****************/
+#if ZERO_CROSS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the zero crossing state and the INT0 detector interrupt.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Note               : The INT0 handler of the detector calls zero_cross_isr, the load CCP
+ *                       scheduler is initialized before by CCP_Compare_Scheduler_Init.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_initialize(const zero_cross_t *_zero_cross, zero_cross_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _zero_cross) || (NULL == _state) || (NULL == _zero_cross->detector) ||
+       (NULL == _zero_cross->load_ccp) || (NULL == _zero_cross->scheduler) ||
+       (INTERRUPT_EXTERNAL_INT0 != _zero_cross->detector->source) || (ZERO_INT == _zero_cross->nominal_interval))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _state->last_crossing = ZERO_INT;
+        _state->interval = ZERO_INT;
+        _state->rejected_edges = ZERO_INT;
+        _state->operate_time = ZERO_INT;
+        _state->fire_delay = ZERO_INT;
+        _state->switch_request = ZERO_CROSS_SWITCH_NONE;
+        _state->locked = STD_IDLE;
+        _state->good_crossings = ZERO_INT;
+        /* @Brief : INT0 is always high priority, so the timestamp latency is short and fixed. */
+        ret = Interrupt_INTx_Init(_zero_cross->detector);
+    }
+    return ret;
+}
+
+/*
+ * @Brief                : To request the relay switched so its contacts move at a crossing.
+ * @Param _state         : Pointer to the zero crossing state.
+ * @Param _switch        : Switch request @Ref : ZERO_CROSS_SWITCH_x.
+ * @Param _operate_time  : Time from the coil drive change to the contacts move, in ticks.
+ * @Note                 : The compare event is queued at the next locked crossing.
+ * @Return Status of the function.
+ *          (E_OK)       : The function done successfully.
+ *          (E_NOT_OK)   : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_switch(zero_cross_state_t *_state, uint8 _switch, uint16 _operate_time)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _state) || (_switch > ZERO_CROSS_SWITCH_ON))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* @Brief : The request and its operate time are taken together by the INT0 interrupt. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _state->operate_time = _operate_time;
+        _state->switch_request = _switch;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To set the triac firing delay after every crossing (phase angle control).
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _fire_delay  : Firing delay in ticks, 0 stops the firing.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_set_firing(zero_cross_state_t *_state, uint16 _fire_delay)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if(NULL == _state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _state->fire_delay = _fire_delay;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To read the filtered crossing interval.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _interval    : Pointer to the crossing interval in ticks, 0 while not locked.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_get_interval(zero_cross_state_t *_state, uint16 *_interval)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _state) || (NULL == _interval))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *_interval = (STD_ACTIVE == _state->locked) ? (uint16)(_state->interval >> ZERO_CROSS_INTERVAL_SHIFT) : ZERO_INT;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To timestamp a crossing and queue the compare events, called from the INT0 handler.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Note               : Runs in a bounded time, at most three events are queued per crossing.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_isr(const zero_cross_t *_zero_cross, zero_cross_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_now = ZERO_INT;
+    uint32 l_crossing = ZERO_INT;
+    uint32 l_measured = ZERO_INT;
+    uint16 l_window = ZERO_INT;
+    if((NULL == _zero_cross) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_Compare_Scheduler_Now(_zero_cross->load_ccp, &l_now);
+        l_crossing = l_now - _zero_cross->detector_delay;
+        l_measured = l_crossing - _state->last_crossing;
+        l_window = _zero_cross->nominal_interval >> ZERO_CROSS_CFG_WINDOW_SHIFT;
+
+        if((l_measured + l_window) < _zero_cross->nominal_interval)
+        {
+            /* @Brief : Noise edge between two crossings, the crossing reference is kept. */
+            _state->rejected_edges++;
+        }
+        else if(l_measured > ((uint32)_zero_cross->nominal_interval + l_window))
+        {
+            /* @Brief : First edge or missed crossings, the interval has to be measured again. */
+            if(ZERO_INT != _state->good_crossings)
+            {
+                _state->rejected_edges++;
+            }
+            else{/*****Nothing*****/}
+            _state->last_crossing = l_crossing;
+            _state->locked = STD_IDLE;
+            /* @Brief : Counts the reference edge, the next good interval is the first one. */
+            _state->good_crossings = 1;
+        }
+        else
+        {
+            _state->last_crossing = l_crossing;
+            if(STD_ACTIVE == _state->locked)
+            {
+                /* @Brief : interval += (measured - interval) / 2^ZERO_CROSS_CFG_FILTER_SHIFT. */
+                _state->interval = (uint32)((sint32)_state->interval +
+                                   (((sint32)(l_measured << ZERO_CROSS_INTERVAL_SHIFT) - (sint32)_state->interval) >>
+                                    ZERO_CROSS_CFG_FILTER_SHIFT));
+                ret &= zero_cross_schedule(_zero_cross, _state, l_now);
+            }
+            else
+            {
+                _state->interval = l_measured << ZERO_CROSS_INTERVAL_SHIFT;
+                _state->good_crossings++;
+                if(_state->good_crossings > ZERO_CROSS_CFG_LOCK_CROSSINGS)
+                {
+                    _state->locked = STD_ACTIVE;
+                    ret &= zero_cross_schedule(_zero_cross, _state, l_now);
+                }
+                else{/*****Nothing*****/}
+            }
+        }
+    }
+    return ret;
+}
+
+/*
+ * @Brief              : To queue the relay switch and triac firing events of the crossing.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _now         : Timebase time of the INT0 timestamp.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+static Std_ReturnType zero_cross_schedule(const zero_cross_t *_zero_cross, zero_cross_state_t *_state, uint32 _now)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_interval = _state->interval >> ZERO_CROSS_INTERVAL_SHIFT;
+    uint32 l_event = ZERO_INT;
+
+    if(ZERO_CROSS_SWITCH_NONE != _state->switch_request)
+    {
+        /* @Brief : The coil drive changes one operate time before a predicted crossing far enough ahead. */
+        l_event = _state->last_crossing + l_interval - _state->operate_time;
+        while((sint32)(l_event - _now) < (sint32)CCP_COMPARE_SCHEDULER_MIN_LEAD_TICKS)
+        {
+            l_event += l_interval;
+        }
+        if(E_OK == CCP_Compare_Scheduler_Add(_zero_cross->load_ccp, _zero_cross->scheduler, l_event,
+                                             (ZERO_CROSS_SWITCH_ON == _state->switch_request) ?
+                                             CCP_COMPARE_EVENT_PIN_HIGH : CCP_COMPARE_EVENT_PIN_LOW))
+        {
+            _state->switch_request = ZERO_CROSS_SWITCH_NONE;
+        }
+        else
+        {
+            /* @Brief : Queue full, tried again at the next crossing. */
+            ret = E_NOT_OK;
+        }
+    }
+    else{/*****Nothing*****/}
+
+    if((ZERO_INT != _state->fire_delay) &&
+       (((uint32)_state->fire_delay + _zero_cross->gate_pulse) < l_interval))
+    {
+        /* @Brief : A firing point already too close is skipped for this half cycle, not fired late. */
+        l_event = _state->last_crossing + _state->fire_delay;
+        if((sint32)(l_event - _now) >= (sint32)CCP_COMPARE_SCHEDULER_MIN_LEAD_TICKS)
+        {
+            ret &= CCP_Compare_Scheduler_Add(_zero_cross->load_ccp, _zero_cross->scheduler,
+                                             l_event, CCP_COMPARE_EVENT_PIN_HIGH);
+            ret &= CCP_Compare_Scheduler_Add(_zero_cross->load_ccp, _zero_cross->scheduler,
+                                             l_event + _zero_cross->gate_pulse, CCP_COMPARE_EVENT_PIN_LOW);
+        }
+        else{/*****Nothing*****/}
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+#endif
+/***********************************************************************/
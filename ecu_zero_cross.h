@@ -0,0 +1,131 @@
+/*
+ * File     : ecu_zero_cross.h
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 12:02 PM
+ */
+
+#ifndef ECU_ZERO_CROSS_H
+#define	ECU_ZERO_CROSS_H
+
+/**************************Includes-Section*****************************/
+#include "ecu_zero_cross_cfg.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#if ZERO_CROSS_CFG==CONFIG_ENABLE
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+#include "../../MCAL_Layer/Interrupt/mcal_external_interrupt.h"
+#endif
+/***********************************************************************/
+
+/**********************Macro Declarations-Section***********************/
+/* @Brief : Macros for the zero crossing switch requests. */
+#define ZERO_CROSS_SWITCH_NONE              0x00U
+#define ZERO_CROSS_SWITCH_OFF               0x01U
+#define ZERO_CROSS_SWITCH_ON                0x02U
+
+/* @Brief : Macro for the fraction bits of the filtered crossing interval. */
+#define ZERO_CROSS_INTERVAL_SHIFT           4
+/***********************************************************************/
+
+/******************Macro Function Declarations-Section******************/
+#if (ZERO_CROSS_CFG==CONFIG_ENABLE) && (CCP_COMPARE_SCHEDULER_CFG!=CONFIG_ENABLE)
+#error "ZERO_CROSS_CFG needs CCP_COMPARE_SCHEDULER_CFG."
+#endif
+
+#if (ZERO_CROSS_CFG==CONFIG_ENABLE) && (EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE)
+#error "ZERO_CROSS_CFG needs the External INTx interrupt feature."
+#endif
+/***********************************************************************/
+
+/********************Data Types Declarations-Section********************/
+#if ZERO_CROSS_CFG==CONFIG_ENABLE
+/*
+ * @Brief : Zero crossing switching configuration, times in CCP timebase ticks.
+ * @Note  : The crossing interval is one half mains cycle for a detector with one edge each
+ *          crossing (10000 us at 50 Hz), or one cycle for a detector with one edge each cycle.
+ */
+typedef struct
+{
+    const interrupt_INTx_t *detector;    /* @Brief : INT0 on the zero crossing detector output. */
+    const ccp_t *load_ccp;               /* @Brief : CCP in Compare mode driving the relay or triac gate pin. */
+    ccp_compare_scheduler_t *scheduler;  /* @Brief : Output compare scheduler of the load CCP. */
+    uint16 nominal_interval;             /* @Brief : Nominal time between two detector edges. */
+    uint16 detector_delay;               /* @Brief : Time from the true crossing to the INT0 timestamp. */
+    uint16 gate_pulse;                   /* @Brief : Triac gate pulse width. */
+}zero_cross_t;
+
+/* @Brief : Zero crossing switching state. */
+typedef struct
+{
+    uint32 last_crossing;                /* @Brief : Timebase time of the last true crossing. */
+    uint32 interval;                     /* @Brief : Filtered crossing interval with ZERO_CROSS_INTERVAL_SHIFT fraction bits. */
+    volatile uint16 rejected_edges;      /* @Brief : Detector edges outside the interval window. */
+    volatile uint16 operate_time;        /* @Brief : Relay operate or release time of the switch request. */
+    volatile uint16 fire_delay;          /* @Brief : Triac firing delay after every crossing, 0 for no firing. */
+    volatile uint8 switch_request;       /* @Brief : Relay switch request @Ref : ZERO_CROSS_SWITCH_x. */
+    volatile uint8 locked;               /* @Brief : STD_ACTIVE while the crossings are predicted. */
+    uint8 good_crossings;                /* @Brief : Crossings in a row inside the window. */
+}zero_cross_state_t;
+#endif
+/***********************************************************************/
+
+/**********Software Interfaces Functions Declarations-Section***********/
+#if ZERO_CROSS_CFG==CONFIG_ENABLE
+/*
+ * @Brief              : Initialize the zero crossing state and the INT0 detector interrupt.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Note               : The INT0 handler of the detector calls zero_cross_isr, the load CCP
+ *                       scheduler is initialized before by CCP_Compare_Scheduler_Init.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_initialize(const zero_cross_t *_zero_cross, zero_cross_state_t *_state);
+
+/*
+ * @Brief                : To request the relay switched so its contacts move at a crossing.
+ * @Param _state         : Pointer to the zero crossing state.
+ * @Param _switch        : Switch request @Ref : ZERO_CROSS_SWITCH_x.
+ * @Param _operate_time  : Time from the coil drive change to the contacts move, in ticks.
+ * @Note                 : The compare event is queued at the next locked crossing.
+ * @Return Status of the function.
+ *          (E_OK)       : The function done successfully.
+ *          (E_NOT_OK)   : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_switch(zero_cross_state_t *_state, uint8 _switch, uint16 _operate_time);
+
+/*
+ * @Brief              : To set the triac firing delay after every crossing (phase angle control).
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _fire_delay  : Firing delay in ticks, 0 stops the firing.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_set_firing(zero_cross_state_t *_state, uint16 _fire_delay);
+
+/*
+ * @Brief              : To read the filtered crossing interval.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Param _interval    : Pointer to the crossing interval in ticks, 0 while not locked.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_get_interval(zero_cross_state_t *_state, uint16 *_interval);
+
+/*
+ * @Brief              : To timestamp a crossing and queue the compare events, called from the INT0 handler.
+ * @Param _zero_cross  : Pointer to the zero crossing configurations.
+ * @Param _state       : Pointer to the zero crossing state.
+ * @Note               : Runs in a bounded time, at most three events are queued per crossing.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue while performing this action.
+ */
+Std_ReturnType zero_cross_isr(const zero_cross_t *_zero_cross, zero_cross_state_t *_state);
+#endif
+/***********************************************************************/
+#endif	/* ECU_ZERO_CROSS_H */
@@ -0,0 +1,44 @@
+/*
+ * File     : ecu_zero_cross_cfg.h
+ * Author   : Mohamed Ahmed Abdel Wahab
+ * LinkedIn : https://www.linkedin.com/in/mohamed-abdel-wahab-162413253/
+ * Github   : https://github.com/moabdelwahab6611
+ * Created on October 19, 2026, 12:02 PM
+ */
+
+#ifndef ECU_ZERO_CROSS_CFG_H
+#define	ECU_ZERO_CROSS_CFG_H
+
+/**************************Includes-Section*****************************/
+
+/***********************************************************************/
+
+/**********************Macro Declarations-Section***********************/
+/*
+ * @Brief : Macro to enable the mains zero crossing synchronized switching of a relay or a triac.
+ * @Note  : Needs INT0 on the zero crossing detector and the CCP output compare scheduler on the load pin.
+ */
+#define ZERO_CROSS_CFG                      CONFIG_DISABLE
+
+/* @Brief : Macro for the accepted crossing interval error, nominal interval / 2 to the power of this shift (12.5 %). */
+#define ZERO_CROSS_CFG_WINDOW_SHIFT         3
+
+/* @Brief : Macro for the crossing interval filter, new intervals count 1 / 2 to the power of this shift. */
+#define ZERO_CROSS_CFG_FILTER_SHIFT         3
+
+/* @Brief : Macro for the crossings in a row inside the window before the switching starts. */
+#define ZERO_CROSS_CFG_LOCK_CROSSINGS       4
+/***********************************************************************/
+
+/******************Macro Function Declarations-Section******************/
+
+/***********************************************************************/
+
+/********************Data Types Declarations-Section********************/
+
+/***********************************************************************/
+
+/**********Software Interfaces Functions Declarations-Section***********/
+
+/***********************************************************************/
+#endif	/* ECU_ZERO_CROSS_CFG_H */
@@ -31,6 +31,163 @@
  */   
 static void CCP_PMW_MODE_CONFIG(const ccp_t *_ccp_obj);   
 
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/* @Brief : Macros for the PWM duty cycle two LSBs (DCxB) position inside CCPxCON. */
+#define CCP_PWM_DCXB_MASK          ((uint8)0x30)
+#define CCP_PWM_DCXB_POSITION      4
+
+/* @Brief : Macro for the fraction bits of the per-mille and Q15 duty cycle scales. */
+#define CCP_PWM_SCALE_SHIFT        15
+
+/* @Brief : PWM period in duty cycle ticks, 4 * (PR2 + 1), computed at CCP_Init. */
+static uint16 ccp_pwm_period_ticks = ZERO_INT;
+/* @Brief : Duty cycle ticks per one per-mille in Q15, computed at CCP_Init. */
+static uint16 ccp_pwm_permille_scale = ZERO_INT;
+
+/*
+ * @Brief             : To write the duty cycle registers of CCP1 or CCP2.
+ * @Param _ccp_obj    : Pointer to the CCP module configurations.
+ * @Param _duty_ticks : Duty cycle in Timer2 input clocks.
+ */
+static void CCP_PWM_Write_Duty(const ccp_t *_ccp_obj, uint16 _duty_ticks);
+#endif
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE)
+/* @Brief : Macro for timer values taken just after a timer overflow. */
+#define CCP_TIMEBASE_LOW_HALF_LIMIT       0x8000
+
+/* @Brief : Upper 16-Bit of the 32-Bit Timer1 and Timer3 CCP timebases. */
+static volatile uint16 ccp_timebase_timer1_overflows = ZERO_INT;
+static volatile uint16 ccp_timebase_timer3_overflows = ZERO_INT;
+
+/*
+ * @Brief          : To extend a 16-Bit time of CCP1 or CCP2 to 32-Bit with its timebase overflows.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Param _value   : Captured or timer 16-Bit value, less than one timer period old.
+ * @Return 32-Bit timebase time.
+ */
+static uint32 CCP_Timebase_Extend(const ccp_t *_ccp_obj, uint16 _value);
+#endif
+
+#if CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the capture engine ring index mask. */
+#define CCP_CAPTURE_ENGINE_INDEX_MASK     (CCP_CAPTURE_ENGINE_BUFFER_SIZE - 1)
+
+/* @Brief : Capture engine phases, edge expected next. */
+#define CCP_CAPTURE_PHASE_FIRST_RISE      0
+#define CCP_CAPTURE_PHASE_FALL            1
+#define CCP_CAPTURE_PHASE_RISE            2
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the compare scheduler queue index mask. */
+#define CCP_COMPARE_SCHEDULER_INDEX_MASK  (CCP_COMPARE_SCHEDULER_QUEUE_SIZE - 1)
+/* @Brief : Macro for the farthest event the 16-Bit compare can arm, farther events arm a wake-up match. */
+#define CCP_COMPARE_SCHEDULER_ARM_LIMIT   0xFFFFUL
+
+/*
+ * @Brief          : To read the 32-Bit timebase time of CCP1 or CCP2.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Return 32-Bit timebase time.
+ */
+static uint32 CCP_Timebase_Now(const ccp_t *_ccp_obj);
+#endif
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE) || \
+    (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) || (CCP_SERVO_CFG==CONFIG_ENABLE)
+/*
+ * @Brief          : To read the 16-Bit timer of CCP1 or CCP2 Capture and Compare modes.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Return 16-Bit timer value.
+ */
+static uint16 CCP_Timebase_Read(const ccp_t *_ccp_obj);
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/*
+ * @Brief            : To arm the next event, or a wake-up match for a far event, on CCP1 or CCP2.
+ * @Param _ccp_obj   : Pointer to the CCP module configurations.
+ * @Param _scheduler : Pointer to the output compare scheduler state.
+ */
+static void CCP_Compare_Scheduler_Arm(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler);
+#endif
+
+#if CCP_SOFT_PWM_CFG==CONFIG_ENABLE
+/*
+ * @Brief           : To sort the duty cycles into a period schedule.
+ * @Param _soft_pwm : Pointer to the software PWM configurations.
+ * @Param _state    : Pointer to the software PWM state.
+ * @Param _schedule : Pointer to the schedule to build.
+ */
+static void CCP_Soft_PWM_Build(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state, 
+                               ccp_soft_pwm_schedule_t *_schedule);
+#endif
+
+#if CCP_SERVO_CFG==CONFIG_ENABLE
+/* @Brief : Macro for the delay before the first servo frame, the time to arm the compare. */
+#define CCP_SERVO_START_LEAD_TICKS        ((uint16)(100 * CCP_SERVO_CFG_TICKS_PER_US))
+#endif
+
+#if CCP_DDS_CFG==CONFIG_ENABLE
+/* @Brief : Macros for the DDS phase bits, the top 8 bits of the accumulator index one sine period. */
+#define CCP_DDS_PHASE_SHIFT               24
+#define CCP_DDS_PHASE_HALF_MASK           ((uint8)0x80)
+#define CCP_DDS_PHASE_QUARTER_MASK        ((uint8)0x40)
+#define CCP_DDS_PHASE_INDEX_MASK          ((uint8)0x3F)
+/* @Brief : Macro for the shift of a sample times duty_scale to duty cycle ticks, 256 samples * 4 / 64. */
+#define CCP_DDS_DUTY_SHIFT                6
+
+/*
+ * @Brief : Quarter sine period, 127.5 * sin((i + 0.5) * 2 * pi / 256) - 0.5 rounded. The half sample
+ *          offset makes the mirrored quarters exact and the samples symmetric around 127.5.
+ */
+static const uint8 ccp_dds_quarter_sine[CCP_DDS_PHASE_INDEX_MASK + 1] =
+{
+      1,   4,   7,  10,  14,  17,  20,  23,  26,  29,  32,  35,  38,  41,  44,  47,
+     50,  53,  55,  58,  61,  64,  66,  69,  72,  74,  77,  79,  82,  84,  86,  89,
+     91,  93,  95,  97,  99, 101, 103, 105, 106, 108, 110, 111, 113, 114, 115, 117,
+    118, 119, 120, 121, 122, 123, 124, 124, 125, 125, 126, 126, 127, 127, 127, 127
+};
+#endif
+
+#if (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) || (CCP_SERVO_CFG==CONFIG_ENABLE)
+/*
+ * @Brief          : To write the CCP1 or CCP2 compare value.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Param _value   : 16-Bit compare value.
+ */
+static void CCP_Write_Compare(const ccp_t *_ccp_obj, uint16 _value);
+#endif
+
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+/* @Brief : ECCP1 P1B, P1C and P1D pins, P1A is the CCP1 pin. */
+static const pin_config_t eccp_bridge_pins[] = 
+{
+    {.port = PORTD_INDEX, .pin = GPIO_PIN5, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    {.port = PORTD_INDEX, .pin = GPIO_PIN6, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    {.port = PORTD_INDEX, .pin = GPIO_PIN7, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW}
+};
+
+/*
+ * @Brief          : ECCP1 half-bridge or full-bridge PWM mode configuration.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ */
+static void CCP_ECCP_Config(const ccp_t *_ccp_obj);
+
+/*
+ * @Brief : To wait for the next Timer2 period boundary, returns at once if Timer2 is off.
+ * @Note  : TMR2IF is set at the post-scaler output, so with a post-scaler above 1:1 the wait can take
+ *          more periods, never less than one boundary. The Timer2 interrupt is disabled by the caller.
+ */
+static void CCP_ECCP_Wait_Period_Boundary(void);
+#endif
+
+/* @Brief : Macros for the T3CON CCP timebase select bits, T3CCP2 is Bit 6 and T3CCP1 is Bit 3. */
+#define CCP_T3CON_TIMEBASE_MASK            0x48
+#define CCP_T3CON_CCP1_CCP2_TIMER3         0x40
+#define CCP_T3CON_CCP1_TIMER1_CCP2_TIMER3  0x08
+#define CCP_T3CON_CCP1_CCP2_TIMER1         0x00
+
 /*
  * @Brief          : To enable or disable the interrupt feature for CCP1 or CCP2.
  * @Param _ccp_obj : Pointer to the CCP module configurations.
@@ -113,8 +270,14 @@ Std_ReturnType CCP_Init(const ccp_t *_ccp_obj)
         ret = gpio_pin_intialize(&(_ccp_obj->ccp_pin));
         /* @Brief : CCP interrupt configurations for CCP1 and CCP2. */
         CCP_Interrupt_Config(_ccp_obj);
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
         /* @Brief : CCP PWM mode configurations for CCP1 and CCP2. */
-        CCP_PMW_MODE_CONFIG(_ccp_obj);
+        if(CCP_PWM_MODE_CFG == _ccp_obj->ccp1_mode)
+        {
+            CCP_PMW_MODE_CONFIG(_ccp_obj);
+        }
+        else{/*****Nothing*****/}
+#endif
         ret = E_OK;
     }
     return ret;
@@ -156,7 +319,44 @@ Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj)
     return ret;  
 }
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
+/*
+ * @Brief               : To move CCP1 and CCP2 Capture and Compare modes between Timer1 and Timer3 at runtime.
+ * @Param _ccp_timebase : CCP1 and CCP2 timer selection @Ref : ccp_capture_timer_t.
+ * @Note                : Both select bits are written at once, so no other pairing is seen in between.
+ *                        The CCP modes, compare values and interrupts are kept.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_Timebase(ccp_capture_timer_t _ccp_timebase)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_select_bits = ZERO_INT;
+    switch(_ccp_timebase)
+    {
+        case CCP1_CCP2_TIMER3 : 
+        l_select_bits = CCP_T3CON_CCP1_CCP2_TIMER3;
+        break;
+        
+        case CCP1_TIMER1_CCP2_TIMER3 : 
+        l_select_bits = CCP_T3CON_CCP1_TIMER1_CCP2_TIMER3;
+        break;
+        
+        case CCP1_CCP2_TIMER1 : 
+        l_select_bits = CCP_T3CON_CCP1_CCP2_TIMER1;
+        break;
+        
+        default : ret = E_NOT_OK; /*****Not supported timebase*****/
+    }
+    if(E_OK == ret)
+    {
+        T3CON = (uint8)((T3CON & (uint8)(~CCP_T3CON_TIMEBASE_MASK)) | l_select_bits);
+    }
+    else{/*****Nothing*****/}
+    return ret;
+}
+
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
 /*
  * @Brief                 : To check Capture mode data status.
  * @Param _capture_status : Pointer to the CCP Capture mode data status.
@@ -189,32 +389,57 @@ Std_ReturnType CCP_IsCapturedDataReady(uint8 *_capture_status)
 
 /*
  * @Brief               : To read Capture mode value.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations. 
  * @Param capture_value : Pointer to the CCP Capture mode value.
+ * @Note                : The value is coherent even when a new capture lands while it is read.
  * @Return Status of the function.
  *          (E_OK)      : The function done successfully.
  *          (E_NOT_OK)  : The function has issue while performing this action.
  */
-Std_ReturnType CCP_Read_Capture_Mode_Value(uint16 *capture_value)
+Std_ReturnType CCP_Read_Capture_Mode_Value(const ccp_t *_ccp_obj, uint16 *capture_value)
 {
     Std_ReturnType ret = E_NOT_OK;
     CCP_REG_T capture_temp_value = {.ccpr_low = 0, .ccpr_high = 0};
     
-    if(NULL == capture_value)
+    if((NULL == _ccp_obj) || (NULL == capture_value))
     {
         ret = E_NOT_OK;
     }
     else
     { 
-        capture_temp_value.ccpr_low = CCPR1L;
-        capture_temp_value.ccpr_high = CCPR1H;
-        *capture_value = capture_temp_value.ccpr_16bit;
         ret = E_OK;
+        /* 
+         * Brief : A capture between the two byte reads can pair a new CCPRxL with the old CCPRxH. The high
+         *         byte is read again and the pair retried until it is the same, a low byte read under a
+         *         stable high byte belongs to one capture.
+         */
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            do
+            {
+                capture_temp_value.ccpr_high = CCPR1H;
+                capture_temp_value.ccpr_low = CCPR1L;
+            }while(capture_temp_value.ccpr_high != CCPR1H);
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst)
+        {
+            do
+            {
+                capture_temp_value.ccpr_high = CCPR2H;
+                capture_temp_value.ccpr_low = CCPR2L;
+            }while(capture_temp_value.ccpr_high != CCPR2H);
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        *capture_value = capture_temp_value.ccpr_16bit;
     }
     return ret;
 }
 #endif
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
 /*
  * @Brief                 : To check Compare mode Compare status if completed or not.
  * @Param _compare_status : Pointer to the CCP Compare mode data status.
@@ -283,11 +508,11 @@ Std_ReturnType CCP_Set_Compare_Mode_Value(const ccp_t *_ccp_obj, uint16 compare_
 }    
 #endif
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
 /*
  * @Brief               : To set duty cycle for PWM mode.
  * @Param _ccp_obj      : Pointer to the CCP module configurations.
- * @Param _duty 
+ * @Param _duty         : Duty cycle in percent (0 : 100).
  * @Return Status of the function.
  *          (E_OK)      : The function done successfully.
  *          (E_NOT_OK)  : The function has issue while performing this action.
@@ -295,31 +520,92 @@ Std_ReturnType CCP_Set_Compare_Mode_Value(const ccp_t *_ccp_obj, uint16 compare_
 Std_ReturnType CCP_Set_PWM_Duty(const ccp_t *_ccp_obj, const uint16 _duty)
 {
     Std_ReturnType ret = E_NOT_OK;
-    uint16 l_duty_temp = 0;
-    if(NULL == _ccp_obj)
+    if((NULL == _ccp_obj) || (_duty > 100))
     {
         ret = E_NOT_OK;
     }
     else
     { 
-        l_duty_temp = (uint16)(4 * (PR2 + 1) * (_duty / 100.0));
-            
-        if(CCP1_INST == _ccp_obj->ccp_inst)
-        {
-            CCP1CONbits.DC1B = (uint8)(l_duty_temp & 0x0003);
-            CCPR1L = (uint8)(l_duty_temp >> 2);
-        }
-        else if(CCP2_INST == _ccp_obj->ccp_inst)
-        {
-            CCP2CONbits.DC2B = (uint8)(l_duty_temp & 0x0003);
-            CCPR2L = (uint8)(l_duty_temp >> 2);
-        }
-        else{/*****Nothing*****/}
-            ret = E_OK;
-        }
+        ret = CCP_Set_PWM_Duty_Permille(_ccp_obj, (uint16)(_duty * 10));
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To set duty cycle for PWM mode as raw 10-Bit value.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _duty_raw     : Duty cycle in Timer2 input clocks, 4 * (PR2 + 1) is 100 %.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Raw(const ccp_t *_ccp_obj, const uint16 _duty_raw)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _ccp_obj) || (_duty_raw > ccp_pwm_period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        CCP_PWM_Write_Duty(_ccp_obj, _duty_raw);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief                : To set duty cycle for PWM mode in per-mille.
+ * @Param _ccp_obj       : Pointer to the CCP module configurations.
+ * @Param _duty_permille : Duty cycle in per-mille (0 : CCP_PWM_DUTY_PERMILLE_FULL_SCALE).
+ * @Return Status of the function.
+ *          (E_OK)       : The function done successfully.
+ *          (E_NOT_OK)   : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Permille(const ccp_t *_ccp_obj, const uint16 _duty_permille)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_duty_ticks = ZERO_INT;
+    if((NULL == _ccp_obj) || (_duty_permille > CCP_PWM_DUTY_PERMILLE_FULL_SCALE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : One multiply by the scale computed at CCP_Init, rounded to the nearest tick. */
+        l_duty_ticks = (uint16)((((uint32)_duty_permille * ccp_pwm_permille_scale) + 
+                                 ((uint32)1 << (CCP_PWM_SCALE_SHIFT - 1))) >> CCP_PWM_SCALE_SHIFT);
+        CCP_PWM_Write_Duty(_ccp_obj, l_duty_ticks);
+        ret = E_OK;
+    }
+    return ret;
+}
 
-        return ret;
+/*
+ * @Brief               : To set duty cycle for PWM mode as Q15 fraction.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _duty_q15     : Duty cycle as Q15 fraction (0 : CCP_PWM_DUTY_Q15_FULL_SCALE).
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Q15(const ccp_t *_ccp_obj, const uint16 _duty_q15)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_duty_ticks = ZERO_INT;
+    if((NULL == _ccp_obj) || (_duty_q15 > CCP_PWM_DUTY_Q15_FULL_SCALE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        l_duty_ticks = (uint16)((((uint32)_duty_q15 * ccp_pwm_period_ticks) + 
+                                 ((uint32)1 << (CCP_PWM_SCALE_SHIFT - 1))) >> CCP_PWM_SCALE_SHIFT);
+        CCP_PWM_Write_Duty(_ccp_obj, l_duty_ticks);
+        ret = E_OK;
     }
+    return ret;
+}
     
 /*
  * @Brief               : To start PWM mode.
@@ -339,7 +625,12 @@ Std_ReturnType CCP_Start_PWM(const ccp_t *_ccp_obj)
     { 
         if(CCP1_INST == _ccp_obj->ccp_inst)
         {
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+            /* @Brief : The ECCP1 PWM mode variant carries the outputs polarity. */
+            CCP1CONbits.CCP1M = _ccp_obj->ccp_mode_variant;
+#else
             CCP1CONbits.CCP1M = CCP_PWM_MODE;
+#endif
         }
         else if(CCP2_INST == _ccp_obj->ccp_inst)
         {
@@ -381,91 +672,1506 @@ Std_ReturnType CCP_Start_PWM(const ccp_t *_ccp_obj)
         return ret;  
     }
 #endif
-    
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE)
 /*
- * @Brief : Callback pointer to function to CCP1 interrupt service routine.
+ * @Brief : To count a Timer1 overflow for the 32-Bit CCP times, called from the Timer1 interrupt handler.
  */
-void CCP1_ISR(void)
+void CCP_Timebase_Timer1_Overflow(void)
 {
-    CCP1_InterruptFlagClear(); 
-    if(CCP1_InterruptHandler)
-    {
-        CCP1_InterruptHandler();
-    }
-    else{/*****Nothing*****/}
+    ccp_timebase_timer1_overflows++;
 }
 
 /*
- * @Brief : Callback pointer to function to CCP2 interrupt service routine.
+ * @Brief : To count a Timer3 overflow for the 32-Bit CCP times, called from the Timer3 interrupt handler.
  */
-void CCP2_ISR(void)
+void CCP_Timebase_Timer3_Overflow(void)
 {
-    CCP2_InterruptFlagClear();
-    if(CCP2_InterruptHandler)
-    {
-        CCP2_InterruptHandler();
-    }
-    else{/*****Nothing*****/}
+    ccp_timebase_timer3_overflows++;
 }
+#endif
 
-#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+#if CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE
 /*
- * @Brief          : PMW mode configuration for CCP1 or CCP2.
- * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Brief               : To start the input capture engine of CCP1 or CCP2 on the next rising edge.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
  */
- static void CCP_PMW_MODE_CONFIG(const ccp_t *_ccp_obj)
- {
-    if(CCP1_INST == _ccp_obj->ccp_inst)
+Std_ReturnType CCP_Capture_Engine_Init(const ccp_t *_ccp_obj, ccp_capture_engine_t *_engine)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _ccp_obj) || (NULL == _engine))
     {
-        /* Brief : CCP1 PWM mode variant initialization. */
-        if(CCP_PWM_MODE == _ccp_obj->ccp_mode_variant)
-        {
-            CCP1_SET_MODE(CCP_PWM_MODE);
-        }  
-        else{/*****Nothing*****/}
+        ret = E_NOT_OK;
     }
-    else if(CCP2_INST == _ccp_obj->ccp_inst)
-    {
-        /* Brief : CCP2 PWM mode variant initialization. */
-        if(CCP_PWM_MODE == _ccp_obj->ccp_mode_variant)
+    else
+    { 
+        _engine->head = ZERO_INT;
+        _engine->count = ZERO_INT;
+        _engine->sequence = ZERO_INT;
+        _engine->phase = CCP_CAPTURE_PHASE_FIRST_RISE;
+        ret = E_OK;
+        if(CCP1_INST == _ccp_obj->ccp_inst)
         {
-            CCP2_SET_MODE(CCP_PWM_MODE);
-        }  
-        else{/*****Nothing*****/}
+            CCP1_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
+            CCP1_InterruptFlagClear();
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst)
+        {
+            CCP2_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
+            CCP2_InterruptFlagClear();
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
     }
-    else{/*****Nothing*****/}
-            
-            
-       /* Brief : CCP PWM mode frequency initialization. */
-    PR2 = (uint8)((_XTAL_FREQ / (_ccp_obj->pwm_frequency * 4.0 * _ccp_obj->timer2_prescaler_value * 
-                   _ccp_obj->timer2_postscaler_value)) - 1);
- }
-#endif
+    return ret;
+}
 
 /*
- * @Brief          : To enable or disable the interrupt feature for CCP1 or CCP2.
- * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Brief               : To time-stamp the captured edge and switch the edge polarity,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _engine       : Pointer to the input capture engine state.
  */
-static void CCP_Interrupt_Config(const ccp_t *_ccp_obj)
+void CCP_Capture_Engine_ISR(const ccp_t *_ccp_obj, ccp_capture_engine_t *_engine)
 {
-    /* @Brief : CCP1 Interrupt configuration. */ 
-#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    CCP1_InterruptEnable();
-    CCP1_InterruptFlagClear();
-    CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
-        
-    /* @Brief : CCP1 Priority configuration. */ 
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_PriorityLevelsEnable(); 
-    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority)
-    {
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP1_HighPrioritySet();
-    }
-    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority)
+    uint16 l_capture = ZERO_INT;
+    uint32 l_time = ZERO_INT;
+    uint8 l_next_mode = CCP_CAPTURE_MODE_1_FALLING_EDGE;
+    ccp_capture_sample_t *l_sample = NULL;
+    
+    if((NULL != _ccp_obj) && (NULL != _engine))
     {
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP1_LowPrioritySet();
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            l_capture = (uint16)CCPR1L;
+            l_capture |= (uint16)((uint16)CCPR1H << 8);
+        }
+        else
+        {
+            l_capture = (uint16)CCPR2L;
+            l_capture |= (uint16)((uint16)CCPR2H << 8);
+        }
+        l_time = CCP_Timebase_Extend(_ccp_obj, l_capture);
+        
+        if(CCP_CAPTURE_PHASE_FALL == _engine->phase)
+        {
+            _engine->last_fall = l_time;
+            _engine->phase = CCP_CAPTURE_PHASE_RISE;
+            l_next_mode = CCP_CAPTURE_MODE_1_RISING_EDGE;
+        }
+        else
+        {
+            /* @Brief : A rising edge closes the measurement started at the previous one. */
+            if(CCP_CAPTURE_PHASE_RISE == _engine->phase)
+            {
+                l_sample = &(_engine->samples[_engine->head]);
+                l_sample->high_time = _engine->last_fall - _engine->last_rise;
+                l_sample->low_time = l_time - _engine->last_fall;
+                l_sample->period = l_time - _engine->last_rise;
+                _engine->head = (uint8)((_engine->head + 1) & CCP_CAPTURE_ENGINE_INDEX_MASK);
+                if(_engine->count < CCP_CAPTURE_ENGINE_BUFFER_SIZE)
+                {
+                    _engine->count++;
+                }
+                else{/*****Nothing*****/}
+                _engine->sequence++;
+            }
+            else{/*****Nothing*****/}
+            _engine->last_rise = l_time;
+            _engine->phase = CCP_CAPTURE_PHASE_FALL;
+        }
+        
+        /* @Brief : A capture mode change may raise a false capture flag, it is cleared after the change. */
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            CCP1_SET_MODE(l_next_mode);
+            CCP1_InterruptFlagClear();
+        }
+        else
+        {
+            CCP2_SET_MODE(l_next_mode);
+            CCP2_InterruptFlagClear();
+        }
+    }
+    else{/*****Nothing*****/}
+}
+
+/*
+ * @Brief               : To read the last input capture measurement.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Param _sample       : Pointer to the last measurement.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : No measurement yet or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Capture_Engine_Get_Last(ccp_capture_engine_t *_engine, ccp_capture_sample_t *_sample)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_sequence = ZERO_INT;
+    if((NULL == _engine) || (NULL == _sample) || (ZERO_INT == _engine->count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : Copy again if a measurement was written during the copy. */
+        do
+        {
+            l_sequence = _engine->sequence;
+            *_sample = _engine->samples[(uint8)(_engine->head - 1) & CCP_CAPTURE_ENGINE_INDEX_MASK];
+        }while(l_sequence != _engine->sequence);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To compute the minimum, maximum and average over the kept measurements.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Param _stats        : Pointer to the statistics.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : No measurement yet or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Capture_Engine_Get_Stats(ccp_capture_engine_t *_engine, ccp_capture_stats_t *_stats)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_sequence = ZERO_INT;
+    uint8 l_index = ZERO_INT;
+    uint32 l_period_sum = ZERO_INT;
+    uint32 l_high_sum = ZERO_INT;
+    ccp_capture_sample_t l_sample;
+    if((NULL == _engine) || (NULL == _stats) || (ZERO_INT == _engine->count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : Compute again if a measurement was written during the pass. */
+        do
+        {
+            l_sequence = _engine->sequence;
+            _stats->samples_number = _engine->count;
+            _stats->period_min = 0xFFFFFFFF;
+            _stats->period_max = ZERO_INT;
+            _stats->high_time_min = 0xFFFFFFFF;
+            _stats->high_time_max = ZERO_INT;
+            l_period_sum = ZERO_INT;
+            l_high_sum = ZERO_INT;
+            for(l_index = ZERO_INT; l_index < _stats->samples_number; l_index++)
+            {
+                l_sample = _engine->samples[l_index];
+                l_period_sum += l_sample.period;
+                l_high_sum += l_sample.high_time;
+                if(l_sample.period < _stats->period_min){ _stats->period_min = l_sample.period; }
+                else{/*****Nothing*****/}
+                if(l_sample.period > _stats->period_max){ _stats->period_max = l_sample.period; }
+                else{/*****Nothing*****/}
+                if(l_sample.high_time < _stats->high_time_min){ _stats->high_time_min = l_sample.high_time; }
+                else{/*****Nothing*****/}
+                if(l_sample.high_time > _stats->high_time_max){ _stats->high_time_max = l_sample.high_time; }
+                else{/*****Nothing*****/}
+            }
+        }while(l_sequence != _engine->sequence);
+        
+        _stats->period_avg = l_period_sum / _stats->samples_number;
+        _stats->high_time_avg = l_high_sum / _stats->samples_number;
+        /* @Brief : Both sums are scaled down together so the per-mille product fits 32-Bit. */
+        while(l_period_sum > 0x003FFFFF)
+        {
+            l_period_sum >>= 1;
+            l_high_sum >>= 1;
+        }
+        _stats->duty_permille = (ZERO_INT == l_period_sum) ? ZERO_INT : (uint16)((l_high_sum * 1000) / l_period_sum);
+        ret = E_OK;
+    }
+    return ret;
+}
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To start an empty output compare scheduler on CCP1 or CCP2.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ * @Param _pin_logic    : CCP pin logic until the first event.
+ * @Note                : The CCP pin is an output and the timebase runs in 16-Bit read/write mode.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Init(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler, logic_t _pin_logic)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _ccp_obj) || (NULL == _scheduler) || 
+       ((CCP1_INST != _ccp_obj->ccp_inst) && (CCP2_INST != _ccp_obj->ccp_inst)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        _scheduler->head = ZERO_INT;
+        _scheduler->count = ZERO_INT;
+        _scheduler->late_events = ZERO_INT;
+        _scheduler->pin_logic = _pin_logic;
+        _scheduler->event_armed = STD_IDLE;
+        /* @Brief : With no event the CCP is off and the pin follows its latch. */
+        ret = gpio_pin_write_logic(&(_ccp_obj->ccp_pin), _pin_logic);
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_DISABLE_MODULE);
+            CCP1_InterruptFlagClear();
+        }
+        else
+        {
+            CCP2_SET_MODE(CCP_DISABLE_MODULE);
+            CCP2_InterruptFlagClear();
+        }
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To queue an output event at an absolute timebase time.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ * @Param _event_time   : 32-Bit timebase time of the event, less than 2^31 ticks ahead.
+ * @Param _event_action : CCP pin action @Ref : CCP_COMPARE_EVENT_PIN_x.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The queue is full or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Add(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler, 
+                                         uint32 _event_time, uint8 _event_action)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_position = ZERO_INT;
+    uint8 l_first_position = ZERO_INT;
+    uint8 l_index = ZERO_INT;
+    uint8 l_previous = ZERO_INT;
+    uint8 l_reschedule = STD_IDLE;
+    uint8 l_interrupt_status = ZERO_INT;
+    uint32 l_now = ZERO_INT;
+    if((NULL == _ccp_obj) || (NULL == _scheduler) || (_event_action > CCP_COMPARE_EVENT_PIN_TOGGLE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : The queue is shared with the CCP interrupt and the timebase with the timer interrupt. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        
+        if(_scheduler->count < CCP_COMPARE_SCHEDULER_QUEUE_SIZE)
+        {
+            l_now = CCP_Timebase_Now(_ccp_obj);
+            /* 
+             * @Brief : An armed head about to match, or already matched, is done by the CCP whatever
+             *          comes before it, so it stays the head the CCP interrupt retires. An earlier new
+             *          event goes right after it and is done late by the CCP interrupt.
+             */
+            if((ZERO_INT != _scheduler->count) && (STD_ACTIVE == _scheduler->event_armed) && 
+               ((((CCP1_INST == _ccp_obj->ccp_inst) && (PIR1bits.CCP1IF)) || 
+                 ((CCP2_INST == _ccp_obj->ccp_inst) && (PIR2bits.CCP2IF))) || 
+                ((sint32)(_scheduler->events[_scheduler->head].event_time - l_now) <= 
+                 (sint32)CCP_COMPARE_SCHEDULER_MIN_LEAD_TICKS)))
+            {
+                l_first_position = 1;
+            }
+            else
+            {
+                l_first_position = ZERO_INT;
+            }
+            
+            /* @Brief : Sorted insert from the tail, events of the same time keep their order. */
+            l_position = _scheduler->count;
+            while(l_position > l_first_position)
+            {
+                l_previous = (uint8)((_scheduler->head + l_position - 1) & CCP_COMPARE_SCHEDULER_INDEX_MASK);
+                if((sint32)(_scheduler->events[l_previous].event_time - _event_time) > 0)
+                {
+                    l_index = (uint8)((_scheduler->head + l_position) & CCP_COMPARE_SCHEDULER_INDEX_MASK);
+                    _scheduler->events[l_index] = _scheduler->events[l_previous];
+                    l_position--;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            
+            /* @Brief : A new head is armed now, the armed one was not about to match. */
+            if(ZERO_INT == l_position)
+            {
+                l_reschedule = STD_ACTIVE;
+            }
+            else{/*****Nothing*****/}
+            
+            l_index = (uint8)((_scheduler->head + l_position) & CCP_COMPARE_SCHEDULER_INDEX_MASK);
+            _scheduler->events[l_index].event_time = _event_time;
+            _scheduler->events[l_index].event_action = _event_action;
+            _scheduler->count++;
+            if(STD_ACTIVE == l_reschedule)
+            {
+                CCP_Compare_Scheduler_Arm(_ccp_obj, _scheduler);
+            }
+            else{/*****Nothing*****/}
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To read the 32-Bit timebase time of CCP1 or CCP2, the reference for the event times.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _time         : Pointer to the 32-Bit timebase time.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Now(const ccp_t *_ccp_obj, uint32 *_time)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _ccp_obj) || (NULL == _time))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : The timer interrupt is held off so the overflow count matches the timer value. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *_time = CCP_Timebase_Now(_ccp_obj);
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To complete the armed event and arm the next one,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ */
+void CCP_Compare_Scheduler_ISR(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler)
+{
+    ccp_compare_event_t *l_event = NULL;
+    if((NULL != _ccp_obj) && (NULL != _scheduler) && (ZERO_INT != _scheduler->count))
+    {
+        /* @Brief : A wake-up match only re-arms, an armed event has been done by the CCP. */
+        if(STD_ACTIVE == _scheduler->event_armed)
+        {
+            l_event = &(_scheduler->events[_scheduler->head]);
+            if(CCP_COMPARE_EVENT_PIN_TOGGLE == l_event->event_action)
+            {
+                _scheduler->pin_logic = !(_scheduler->pin_logic);
+            }
+            else
+            {
+                _scheduler->pin_logic = l_event->event_action;
+            }
+            _scheduler->head = (uint8)((_scheduler->head + 1) & CCP_COMPARE_SCHEDULER_INDEX_MASK);
+            _scheduler->count--;
+        }
+        else{/*****Nothing*****/}
+        CCP_Compare_Scheduler_Arm(_ccp_obj, _scheduler);
+    }
+    else{/*****Nothing*****/}
+}
+#endif
+
+#if CCP_SOFT_PWM_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the software PWM channels off and start the period timing.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Note                : The CCP is initialized in Compare mode with its interrupt and a free running timebase.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Init(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_channel = ZERO_INT;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _soft_pwm) || (NULL == _state) || (NULL == _soft_pwm->soft_pwm_ccp) || 
+       (NULL == _soft_pwm->soft_pwm_channels) || 
+       (_soft_pwm->soft_pwm_channels_number > CCP_SOFT_PWM_CFG_MAX_CHANNELS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        ret = E_OK;
+        for(l_channel = ZERO_INT; l_channel < _soft_pwm->soft_pwm_channels_number; l_channel++)
+        {
+            _state->duty[l_channel] = CCP_SOFT_PWM_DUTY_MIN;
+            ret &= gpio_pin_direction_intialize(&(_soft_pwm->soft_pwm_channels[l_channel]));
+            ret &= gpio_pin_write_logic(&(_soft_pwm->soft_pwm_channels[l_channel]), GPIO_LOW);
+        }
+        CCP_Soft_PWM_Build(_soft_pwm, _state, &(_state->schedules[ZERO_INT]));
+        _state->active_schedule = ZERO_INT;
+        _state->schedule_pending = STD_IDLE;
+        _state->duty_changed = STD_IDLE;
+        
+        /* @Brief : The first period starts after the arming time, at the end of an empty period. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _state->next_edge = _state->schedules[ZERO_INT].edges_number;
+        _state->period_start = (uint16)(CCP_Timebase_Read(_soft_pwm->soft_pwm_ccp) + 
+                                        CCP_SOFT_PWM_CFG_MIN_LEAD_TICKS - CCP_SOFT_PWM_PERIOD_TICKS);
+        CCP_Write_Compare(_soft_pwm->soft_pwm_ccp, (uint16)(_state->period_start + CCP_SOFT_PWM_PERIOD_TICKS));
+        if(CCP1_INST == _soft_pwm->soft_pwm_ccp->ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+            CCP1_InterruptFlagClear();
+        }
+        else
+        {
+            CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+            CCP2_InterruptFlagClear();
+        }
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To set the duty cycle of one software PWM channel.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Param _channel      : Channel index in the configuration pins.
+ * @Param _duty         : Duty cycle steps from CCP_SOFT_PWM_DUTY_MIN to CCP_SOFT_PWM_DUTY_MAX.
+ * @Note                : The new duty cycles are output after CCP_Soft_PWM_Update, at a period start.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Set_Duty(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state, 
+                                     uint8 _channel, uint8 _duty)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _soft_pwm) || (NULL == _state) || (_channel >= _soft_pwm->soft_pwm_channels_number))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        if(_state->duty[_channel] != _duty)
+        {
+            _state->duty[_channel] = _duty;
+            _state->duty_changed = STD_ACTIVE;
+        }
+        else{/*****Nothing*****/}
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To sort the changed duty cycles into the next period schedule, called from the main loop.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Update(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _soft_pwm) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : The schedule not played is free once the interrupt took the pending one. */
+        if((STD_ACTIVE == _state->duty_changed) && (STD_IDLE == _state->schedule_pending))
+        {
+            _state->duty_changed = STD_IDLE;
+            CCP_Soft_PWM_Build(_soft_pwm, _state, &(_state->schedules[_state->active_schedule ^ 1]));
+            _state->schedule_pending = STD_ACTIVE;
+        }
+        else{/*****Nothing*****/}
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To output the due edges and arm the next one, called from the CCP1 or CCP2 interrupt handler.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ */
+void CCP_Soft_PWM_ISR(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state)
+{
+    ccp_soft_pwm_schedule_t *l_schedule = NULL;
+    uint16 l_next_time = ZERO_INT;
+    uint8 l_port = ZERO_INT;
+    
+    if((NULL != _soft_pwm) && (NULL != _state))
+    {
+        l_schedule = &(_state->schedules[_state->active_schedule]);
+        do
+        {
+            if(_state->next_edge >= l_schedule->edges_number)
+            {
+                /* @Brief : Period start, a pending schedule is taken here so no period mixes two schedules. */
+                _state->period_start += CCP_SOFT_PWM_PERIOD_TICKS;
+                if(STD_ACTIVE == _state->schedule_pending)
+                {
+                    _state->active_schedule ^= 1;
+                    _state->schedule_pending = STD_IDLE;
+                    l_schedule = &(_state->schedules[_state->active_schedule]);
+                }
+                else{/*****Nothing*****/}
+                for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+                {
+                    if(ZERO_INT != l_schedule->used_masks[l_port])
+                    {
+                        gpio_port_write_logic_masked(l_port, l_schedule->used_masks[l_port], l_schedule->on_masks[l_port]);
+                    }
+                    else{/*****Nothing*****/}
+                }
+                _state->next_edge = ZERO_INT;
+            }
+            else
+            {
+                /* @Brief : All channels of the same duty cycle fall with one latch update on each port. */
+                for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+                {
+                    if(ZERO_INT != l_schedule->edges[_state->next_edge].edge_masks[l_port])
+                    {
+                        gpio_port_write_logic_masked(l_port, l_schedule->edges[_state->next_edge].edge_masks[l_port], ZERO_INT);
+                    }
+                    else{/*****Nothing*****/}
+                }
+                _state->next_edge++;
+            }
+            
+            if(_state->next_edge < l_schedule->edges_number)
+            {
+                l_next_time = _state->period_start + l_schedule->edges[_state->next_edge].edge_offset;
+            }
+            else
+            {
+                l_next_time = _state->period_start + CCP_SOFT_PWM_PERIOD_TICKS;
+            }
+            /* @Brief : An edge too close to be armed is output in this interrupt. */
+        }while((sint16)(l_next_time - CCP_Timebase_Read(_soft_pwm->soft_pwm_ccp)) < (sint16)CCP_SOFT_PWM_CFG_MIN_LEAD_TICKS);
+        CCP_Write_Compare(_soft_pwm->soft_pwm_ccp, l_next_time);
+    }
+    else{/*****Nothing*****/}
+}
+#endif
+
+#if CCP_SERVO_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the servo pins low with centred pulses and start the frame timing.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Note                : The CCP is initialized in Compare mode with its interrupt and a free running timebase.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Init(const ccp_servo_t *_servo, ccp_servo_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INT;
+    uint8 l_interrupt_status = ZERO_INT;
+    if((NULL == _servo) || (NULL == _state) || (NULL == _servo->servo_ccp) || (NULL == _servo->servo_pins) || 
+       (_servo->servos_number > CCP_SERVO_CFG_MAX_SERVOS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        ret = E_OK;
+        for(l_index = ZERO_INT; l_index < _servo->servos_number; l_index++)
+        {
+            _state->requested_ticks[l_index] = (uint16)(CCP_SERVO_CENTRE_PULSE_US * CCP_SERVO_CFG_TICKS_PER_US);
+            _state->pulse_ticks[0][l_index] = _state->requested_ticks[l_index];
+            _state->pulse_ticks[1][l_index] = _state->requested_ticks[l_index];
+            ret &= gpio_pin_direction_intialize(&(_servo->servo_pins[l_index]));
+            ret &= gpio_pin_write_logic(&(_servo->servo_pins[l_index]), GPIO_LOW);
+        }
+        _state->active_buffer = ZERO_INT;
+        _state->buffer_pending = STD_IDLE;
+        _state->pulses_changed = STD_IDLE;
+        
+        /* @Brief : The first frame starts after the arming time, at the end of a frame gap. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _state->slot = _servo->servos_number;
+        _state->frame_start = (uint16)(CCP_Timebase_Read(_servo->servo_ccp) + 
+                                       CCP_SERVO_START_LEAD_TICKS - CCP_SERVO_FRAME_TICKS);
+        _state->slot_time = (uint16)(_state->frame_start + CCP_SERVO_FRAME_TICKS);
+        CCP_Write_Compare(_servo->servo_ccp, _state->slot_time);
+        if(CCP1_INST == _servo->servo_ccp->ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+            CCP1_InterruptFlagClear();
+        }
+        else
+        {
+            CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+            CCP2_InterruptFlagClear();
+        }
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To set the pulse width of one servo.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Param _index        : Servo index in the configuration pins.
+ * @Param _pulse_us     : Pulse width from CCP_SERVO_CFG_MIN_PULSE_US to CCP_SERVO_CFG_MAX_PULSE_US.
+ * @Note                : The new pulse widths are output after CCP_Servo_Update, at a frame start.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Set_Pulse(const ccp_servo_t *_servo, ccp_servo_state_t *_state, 
+                                   uint8 _index, uint16 _pulse_us)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _servo) || (NULL == _state) || (_index >= _servo->servos_number) || 
+       (_pulse_us < CCP_SERVO_CFG_MIN_PULSE_US) || (_pulse_us > CCP_SERVO_CFG_MAX_PULSE_US))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        _state->requested_ticks[_index] = (uint16)(_pulse_us * CCP_SERVO_CFG_TICKS_PER_US);
+        _state->pulses_changed = STD_ACTIVE;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To hand the pulse widths set together to the next frame, called from the main loop.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Update(const ccp_servo_t *_servo, ccp_servo_state_t *_state)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INT;
+    uint16 *l_buffer = NULL;
+    if((NULL == _servo) || (NULL == _state))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : The buffer not played is free once the interrupt took the pending one. */
+        if((STD_ACTIVE == _state->pulses_changed) && (STD_IDLE == _state->buffer_pending))
+        {
+            _state->pulses_changed = STD_IDLE;
+            l_buffer = _state->pulse_ticks[_state->active_buffer ^ 1];
+            for(l_index = ZERO_INT; l_index < _servo->servos_number; l_index++)
+            {
+                l_buffer[l_index] = _state->requested_ticks[l_index];
+            }
+            _state->buffer_pending = STD_ACTIVE;
+        }
+        else{/*****Nothing*****/}
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To end the running pulse, start the next one and arm its end,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Note                : An edge closer than CCP_SERVO_CFG_MIN_LEAD_TICKS is pushed forward, that pulse is longer.
+ */
+void CCP_Servo_ISR(const ccp_servo_t *_servo, ccp_servo_state_t *_state)
+{
+    uint16 l_now = ZERO_INT;
+    
+    if((NULL != _servo) && (NULL != _state))
+    {
+        /* @Brief : The pulses are back to back, one servo ends where the next one starts. */
+        if(_state->slot < _servo->servos_number)
+        {
+            gpio_pin_write_logic(&(_servo->servo_pins[_state->slot]), GPIO_LOW);
+            _state->slot++;
+        }
+        else
+        {
+            /* @Brief : Frame start, a pending buffer is taken here so no frame mixes two buffers. */
+            _state->frame_start = _state->slot_time;
+            if(STD_ACTIVE == _state->buffer_pending)
+            {
+                _state->active_buffer ^= 1;
+                _state->buffer_pending = STD_IDLE;
+            }
+            else{/*****Nothing*****/}
+            _state->slot = ZERO_INT;
+        }
+        
+        if(_state->slot < _servo->servos_number)
+        {
+            gpio_pin_write_logic(&(_servo->servo_pins[_state->slot]), GPIO_HIGH);
+            _state->slot_time += _state->pulse_ticks[_state->active_buffer][_state->slot];
+        }
+        else
+        {
+            _state->slot_time = (uint16)(_state->frame_start + CCP_SERVO_FRAME_TICKS);
+        }
+        /* @Brief : A late edge would be missed for a full timer turn, it is pushed forward and the pulse is longer. */
+        l_now = CCP_Timebase_Read(_servo->servo_ccp);
+        if((sint16)(_state->slot_time - l_now) < (sint16)CCP_SERVO_CFG_MIN_LEAD_TICKS)
+        {
+            _state->slot_time = (uint16)(l_now + CCP_SERVO_CFG_MIN_LEAD_TICKS);
+        }
+        else{/*****Nothing*****/}
+        CCP_Write_Compare(_servo->servo_ccp, _state->slot_time);
+    }
+    else{/*****Nothing*****/}
+}
+#endif
+
+#if CCP_DDS_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the DDS at 0 Hz, the PWM output stays at the middle duty cycle.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Note                : The CCP is initialized before in PWM mode and Timer2 with its interrupt, the
+ *                        sample rate is taken from PR2 and the Timer2 pre-scaler and post-scaler.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action, or the sample rate
+ *                        is above CCP_DDS_MAX_SAMPLE_RATE, the rate the CPU can serve.
+ */
+Std_ReturnType CCP_DDS_Init(const ccp_t *_ccp_obj, ccp_dds_t *_dds)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    uint16 l_prescaler = ZERO_INT;
+    uint32 l_sample_rate = ZERO_INT;
+    if((NULL == _ccp_obj) || (NULL == _dds))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        l_prescaler = (ZERO_INT == T2CONbits.T2CKPS) ? 1 : ((1 == T2CONbits.T2CKPS) ? 4 : 16);
+        l_sample_rate = ((uint32)_XTAL_FREQ / 4) / 
+                        ((uint32)l_prescaler * ((uint16)PR2 + 1) * ((uint16)T2CONbits.TOUTPS + 1));
+        if(l_sample_rate > CCP_DDS_MAX_SAMPLE_RATE)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            l_interrupt_status = INTCONbits.GIE;
+            INTCONbits.GIE = 0;
+            _dds->phase = ZERO_INT;
+            _dds->phase_step = ZERO_INT;
+            _dds->sample_rate = l_sample_rate;
+            /* @Brief : 2^32 = 0xFFFFFFFF + 1, so the remainder of 0xFFFFFFFF takes one more. */
+            _dds->step_per_hz = 0xFFFFFFFFUL / l_sample_rate;
+            _dds->step_per_hz_rest = (0xFFFFFFFFUL % l_sample_rate) + 1;
+            if(_dds->step_per_hz_rest == l_sample_rate)
+            {
+                _dds->step_per_hz++;
+                _dds->step_per_hz_rest = ZERO_INT;
+            }
+            else{/*****Nothing*****/}
+            _dds->duty_scale = (uint16)PR2 + 1;
+            CCP_PWM_Write_Duty(_ccp_obj, (uint16)((CCP_DDS_SAMPLE_MIDDLE * _dds->duty_scale) >> CCP_DDS_DUTY_SHIFT));
+            INTCONbits.GIE = l_interrupt_status;
+            ret = E_OK;
+        }
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To set the DDS output frequency.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Param _frequency_hz : Output frequency in Hz, up to half the sample rate.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_DDS_Set_Frequency(ccp_dds_t *_dds, uint32 _frequency_hz)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_phase_step = ZERO_INT;
+    if((NULL == _dds) || (ZERO_INT == _dds->sample_rate) || (_frequency_hz > (_dds->sample_rate >> 1)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : _frequency_hz * 2^32 / sample_rate rounded, the rest product stays below 2^31. */
+        l_phase_step = (_frequency_hz * _dds->step_per_hz) + 
+                       (((_frequency_hz * _dds->step_per_hz_rest) + (_dds->sample_rate >> 1)) / _dds->sample_rate);
+        ret = CCP_DDS_Set_Phase_Step(_dds, l_phase_step);
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To set the DDS phase step directly, for the sample_rate / 2^32 frequency resolution.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Param _phase_step   : Phase step, output frequency = _phase_step * sample_rate / 2^32.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_DDS_Set_Phase_Step(ccp_dds_t *_dds, uint32 _phase_step)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if(NULL == _dds)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        /* @Brief : The 32-Bit step is written in 4 bytes, the interrupt never adds a half written step. */
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        _dds->phase_step = _phase_step;
+        INTCONbits.GIE = l_interrupt_status;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To step the phase and write the next sine sample to the PWM duty cycle,
+ *                        called from the Timer2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Note                : No loop and no division, every sample takes the same time.
+ */
+void CCP_DDS_ISR(const ccp_t *_ccp_obj, ccp_dds_t *_dds)
+{
+    uint8 l_phase = ZERO_INT;
+    uint8 l_sample = ZERO_INT;
+    if((NULL != _ccp_obj) && (NULL != _dds))
+    {
+        _dds->phase += _dds->phase_step;
+        l_phase = (uint8)(_dds->phase >> CCP_DDS_PHASE_SHIFT);
+        
+        /* @Brief : The second and fourth quarters read the table backwards, 63 - index is ~index. */
+        if(l_phase & CCP_DDS_PHASE_QUARTER_MASK)
+        {
+            l_sample = ccp_dds_quarter_sine[(uint8)(~l_phase) & CCP_DDS_PHASE_INDEX_MASK];
+        }
+        else
+        {
+            l_sample = ccp_dds_quarter_sine[l_phase & CCP_DDS_PHASE_INDEX_MASK];
+        }
+        /* @Brief : The second half period is the first one mirrored around 127.5. */
+        if(l_phase & CCP_DDS_PHASE_HALF_MASK)
+        {
+            l_sample = (uint8)((CCP_DDS_SAMPLE_MIDDLE - 1) - l_sample);
+        }
+        else
+        {
+            l_sample = (uint8)(CCP_DDS_SAMPLE_MIDDLE + l_sample);
+        }
+        CCP_PWM_Write_Duty(_ccp_obj, (uint16)(((uint16)l_sample * _dds->duty_scale) >> CCP_DDS_DUTY_SHIFT));
+    }
+    else{/*****Nothing*****/}
+}
+#endif
+
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To reverse the ECCP1 full-bridge without shoot-through.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _direction    : CCP_ECCP_FULL_BRIDGE_FORWARD or CCP_ECCP_FULL_BRIDGE_REVERSE.
+ * @Note                : The modulated outputs are held off for one PWM period around the swap,
+ *                        the function waits for one Timer2 period boundary with the Timer2 interrupt
+ *                        held off, so a duty ramp or DDS tick runs after the swap.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Set_Bridge_Direction(const ccp_t *_ccp_obj, uint8 _direction)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_ccpr1l = ZERO_INT;
+    uint8 l_dc1b = ZERO_INT;
+    uint8 l_timer2_interrupt = ZERO_INT;
+    if((NULL == _ccp_obj) || (CCP1_INST != _ccp_obj->ccp_inst) || 
+       ((CCP_ECCP_FULL_BRIDGE_FORWARD != _direction) && (CCP_ECCP_FULL_BRIDGE_REVERSE != _direction)) || 
+       ((CCP_ECCP_FULL_BRIDGE_FORWARD != CCP1CONbits.P1M) && (CCP_ECCP_FULL_BRIDGE_REVERSE != CCP1CONbits.P1M)))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(_direction == CCP1CONbits.P1M)
+    {
+        ret = E_OK;
+    }
+    else
+    { 
+        /* 
+         * Brief : The static output of the old direction turns off as the new one turns on,
+         *         so the modulated outputs stay off for the whole period after the swap.
+         */
+        /* 
+         * Brief : The Timer2 handler would clear TMR2IF before the wait sees it, and a duty ramp or
+         *         DDS tick would write a duty inside the off period, it is held off until the swap is done.
+         */
+        l_timer2_interrupt = PIE1bits.TMR2IE;
+        PIE1bits.TMR2IE = 0;
+        l_ccpr1l = CCPR1L;
+        l_dc1b = (uint8)(CCP1CON & CCP_PWM_DCXB_MASK);
+        CCP_PWM_Write_Duty(_ccp_obj, ZERO_INT);
+        CCP_ECCP_Wait_Period_Boundary();
+        CCP1CONbits.P1M = _direction;
+        /* Brief : The saved duty is latched at the next period boundary. */
+        CCP1CON = (uint8)((CCP1CON & (uint8)(~CCP_PWM_DCXB_MASK)) | l_dc1b);
+        CCPR1L = l_ccpr1l;
+        PIE1bits.TMR2IE = l_timer2_interrupt;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief                  : To check if ECCP1 outputs are shut down.
+ * @Param _ccp_obj         : Pointer to the CCP module configurations.
+ * @Param _shutdown_status : Pointer to the shutdown status @Ref : CCP_ECCP_SHUTDOWN_x.
+ * @Return Status of the function.
+ *          (E_OK)         : The function done successfully.
+ *          (E_NOT_OK)     : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Get_Shutdown_Status(const ccp_t *_ccp_obj, uint8 *_shutdown_status)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _ccp_obj) || (NULL == _shutdown_status) || (CCP1_INST != _ccp_obj->ccp_inst))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        *_shutdown_status = (ECCP1ASbits.ECCPASE) ? CCP_ECCP_SHUTDOWN_ACTIVE : CCP_ECCP_SHUTDOWN_INACTIVE;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*
+ * @Brief               : To restart ECCP1 outputs after a shutdown when auto-restart is not used.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Note                : The outputs stay shut down while the shutdown source is still active.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Restart(const ccp_t *_ccp_obj)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == _ccp_obj) || (CCP1_INST != _ccp_obj->ccp_inst))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    { 
+        ECCP1ASbits.ECCPASE = 0;
+        ret = E_OK;
+    }
+    return ret;
+}
+#endif
+    
+/*
+ * @Brief : Callback pointer to function to CCP1 interrupt service routine.
+ */
+void CCP1_ISR(void)
+{
+    CCP1_InterruptFlagClear(); 
+    if(CCP1_InterruptHandler)
+    {
+        CCP1_InterruptHandler();
+    }
+    else{/*****Nothing*****/}
+}
+
+/*
+ * @Brief : Callback pointer to function to CCP2 interrupt service routine.
+ */
+void CCP2_ISR(void)
+{
+    CCP2_InterruptFlagClear();
+    if(CCP2_InterruptHandler)
+    {
+        CCP2_InterruptHandler();
+    }
+    else{/*****Nothing*****/}
+}
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/*
+ * @Brief          : PMW mode configuration for CCP1 or CCP2.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ */
+ static void CCP_PMW_MODE_CONFIG(const ccp_t *_ccp_obj)
+ {
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+        /* Brief : ECCP1 bridge outputs, dead-band and auto-shutdown initialization. */
+        CCP_ECCP_Config(_ccp_obj);
+#else
+        /* Brief : CCP1 PWM mode variant initialization. */
+        if(CCP_PWM_MODE == _ccp_obj->ccp_mode_variant)
+        {
+            CCP1_SET_MODE(CCP_PWM_MODE);
+        }  
+        else{/*****Nothing*****/}
+#endif
+    }
+    else if(CCP2_INST == _ccp_obj->ccp_inst)
+    {
+        /* Brief : CCP2 PWM mode variant initialization. */
+        if(CCP_PWM_MODE == _ccp_obj->ccp_mode_variant)
+        {
+            CCP2_SET_MODE(CCP_PWM_MODE);
+        }  
+        else{/*****Nothing*****/}
+    }
+    else{/*****Nothing*****/}
+            
+            
+#if CCP_PWM_PLANNER_CFG==CONFIG_ENABLE
+    /* Brief : CCP PWM mode frequency chosen at compile time by the PWM frequency planner. */
+    PR2 = (uint8)CCP_PWM_PLAN_PR2;
+#else
+       /* Brief : CCP PWM mode frequency initialization. */
+    PR2 = (uint8)((_XTAL_FREQ / (_ccp_obj->pwm_frequency * 4.0 * _ccp_obj->timer2_prescaler_value * 
+                   _ccp_obj->timer2_postscaler_value)) - 1);
+#endif
+    
+    /* Brief : PWM period and per-mille scale used by the duty cycle functions. */
+    ccp_pwm_period_ticks = (uint16)(((uint16)PR2 + 1) << 2);
+    ccp_pwm_permille_scale = (uint16)((((uint32)ccp_pwm_period_ticks << CCP_PWM_SCALE_SHIFT) + 
+                                       (CCP_PWM_DUTY_PERMILLE_FULL_SCALE / 2)) / CCP_PWM_DUTY_PERMILLE_FULL_SCALE);
+ }
+
+/*
+ * @Brief             : To write the duty cycle registers of CCP1 or CCP2.
+ * @Param _ccp_obj    : Pointer to the CCP module configurations.
+ * @Param _duty_ticks : Duty cycle in Timer2 input clocks.
+ */
+static void CCP_PWM_Write_Duty(const ccp_t *_ccp_obj, uint16 _duty_ticks)
+{
+    uint8 l_duty_high = (uint8)(_duty_ticks >> 2);
+    uint8 l_duty_low = (uint8)((_duty_ticks & 0x0003) << CCP_PWM_DCXB_POSITION);
+    
+    /* 
+     * Brief : The new duty is latched at the next period boundary. Both halves are prepared first,
+     *         then the two LSBs go with one byte write and CCPRxL right after. A boundary falling
+     *         between the two writes latches at most 3 ticks away from the old duty for one period.
+     */
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCP1CON = (uint8)((CCP1CON & (uint8)(~CCP_PWM_DCXB_MASK)) | l_duty_low);
+        CCPR1L = l_duty_high;
+    }
+    else if(CCP2_INST == _ccp_obj->ccp_inst)
+    {
+        CCP2CON = (uint8)((CCP2CON & (uint8)(~CCP_PWM_DCXB_MASK)) | l_duty_low);
+        CCPR2L = l_duty_high;
+    }
+    else{/*****Nothing*****/}
+}
+#endif
+
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+/*
+ * @Brief          : ECCP1 half-bridge or full-bridge PWM mode configuration.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ */
+static void CCP_ECCP_Config(const ccp_t *_ccp_obj)
+{
+    uint8 l_pin_index = ZERO_INT;
+    uint8 l_bridge_pins = ZERO_INT;
+    
+    if((_ccp_obj->ccp_mode_variant >= CCP_ECCP_PWM_AC_HIGH_BD_HIGH) && 
+       (_ccp_obj->ccp_mode_variant <= CCP_ECCP_PWM_AC_LOW_BD_LOW))
+    {
+        /* Brief : Auto-shutdown and dead-band before the outputs are driven. */
+        ECCP1AS = (uint8)((_ccp_obj->eccp_shutdown_source << 4) | (_ccp_obj->eccp_shutdown_state_ac << 2) | 
+                          (_ccp_obj->eccp_shutdown_state_bd));
+        ECCP1DEL = (uint8)((_ccp_obj->eccp_auto_restart << 7) | (_ccp_obj->eccp_dead_band));
+        CCP1CON = (uint8)((_ccp_obj->eccp_output_mode << 6) | _ccp_obj->ccp_mode_variant);
+        
+        /* Brief : P1B for the half-bridge, P1B, P1C and P1D for the full-bridge. */
+        if(CCP_ECCP_HALF_BRIDGE == _ccp_obj->eccp_output_mode)
+        {
+            l_bridge_pins = 1;
+        }
+        else if(CCP_ECCP_SINGLE_OUTPUT != _ccp_obj->eccp_output_mode)
+        {
+            l_bridge_pins = 3;
+        }
+        else{/*****Nothing*****/}
+        for(l_pin_index = ZERO_INT; l_pin_index < l_bridge_pins; l_pin_index++)
+        {
+            gpio_pin_intialize(&(eccp_bridge_pins[l_pin_index]));
+        }
+    }
+    else{/*****Nothing*****/}
+}
+
+/*
+ * @Brief : To wait for the next Timer2 period boundary, returns at once if Timer2 is off.
+ * @Note  : TMR2IF is set at the post-scaler output, so with a post-scaler above 1:1 the wait can take
+ *          more periods, never less than one boundary. The Timer2 interrupt is disabled by the caller.
+ */
+static void CCP_ECCP_Wait_Period_Boundary(void)
+{
+    /* 
+     * Brief : TMR2IF is set by the hardware at the TMR2 to PR2 match, which no TMR2 polling can miss
+     *         at a small PR2. The flag is left set so the Timer2 handler runs once it is enabled again.
+     */
+    PIR1bits.TMR2IF = 0;
+    while(T2CONbits.TMR2ON && (0 == PIR1bits.TMR2IF))
+    {
+        /*****Nothing*****/
+    }
+}
+#endif
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE)
+/*
+ * @Brief          : To extend a 16-Bit time of CCP1 or CCP2 to 32-Bit with its timebase overflows.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Param _value   : Captured or timer 16-Bit value, less than one timer period old.
+ * @Return 32-Bit timebase time.
+ */
+static uint32 CCP_Timebase_Extend(const ccp_t *_ccp_obj, uint16 _value)
+{
+    uint16 l_overflows = ZERO_INT;
+    uint16 l_now = ZERO_INT;
+    uint8 l_overflow_pending = ZERO_INT;
+    uint8 l_interrupt_status = ZERO_INT;
+    
+    /* @Brief : The timer, its overflow count and its overflow flag are taken together. */
+    l_interrupt_status = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+    l_now = CCP_Timebase_Read(_ccp_obj);
+    if(CCP_TIMEBASE_IS_TIMER3(_ccp_obj->ccp_inst))
+    {
+        l_overflows = ccp_timebase_timer3_overflows;
+        l_overflow_pending = PIR2bits.TMR3IF;
+    }
+    else
+    {
+        l_overflows = ccp_timebase_timer1_overflows;
+        l_overflow_pending = PIR1bits.TMR1IF;
+    }
+    INTCONbits.GIE = l_interrupt_status;
+    
+    /* @Brief : The timer was read after an overflow whose interrupt has not run yet. */
+    if((l_overflow_pending) && (l_now < CCP_TIMEBASE_LOW_HALF_LIMIT))
+    {
+        l_overflows++;
+    }
+    else{/*****Nothing*****/}
+    
+    /* 
+     * @Brief : InterruptManager runs the Timer1 and Timer3 handlers before the CCP1 and CCP2 ones, so
+     *          the overflow right after a capture can be counted and its flag cleared before the capture
+     *          is read. The 32-Bit time is built for the timer read now, where the count always fits,
+     *          and the age of _value is taken back from it.
+     */
+    return ((((uint32)l_overflows << 16) | l_now) - (uint16)(l_now - _value));
+}
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/*
+ * @Brief          : To read the 32-Bit timebase time of CCP1 or CCP2.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Return 32-Bit timebase time.
+ */
+static uint32 CCP_Timebase_Now(const ccp_t *_ccp_obj)
+{
+    return CCP_Timebase_Extend(_ccp_obj, CCP_Timebase_Read(_ccp_obj));
+}
+
+/*
+ * @Brief            : To arm the next event, or a wake-up match for a far event, on CCP1 or CCP2.
+ * @Param _ccp_obj   : Pointer to the CCP module configurations.
+ * @Param _scheduler : Pointer to the output compare scheduler state.
+ */
+static void CCP_Compare_Scheduler_Arm(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler)
+{
+    ccp_compare_event_t *l_event = NULL;
+    uint32 l_delta = ZERO_INT;
+    uint8 l_next_logic = GPIO_LOW;
+    uint8 l_mode = CCP_DISABLE_MODULE;
+    
+    /* 
+     * @Brief : The pin latch holds the pin logic while the compare output is off,
+     *          then the software interrupt mode leaves the pin to its latch while the compare is loaded.
+     */
+    gpio_pin_write_logic(&(_ccp_obj->ccp_pin), _scheduler->pin_logic);
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+    }
+    else
+    {
+        CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+    }
+    _scheduler->event_armed = STD_IDLE;
+    
+    while((ZERO_INT != _scheduler->count) && (CCP_DISABLE_MODULE == l_mode))
+    {
+        l_event = &(_scheduler->events[_scheduler->head]);
+        if(CCP_COMPARE_EVENT_PIN_TOGGLE == l_event->event_action)
+        {
+            l_next_logic = !(_scheduler->pin_logic);
+        }
+        else
+        {
+            l_next_logic = l_event->event_action;
+        }
+        l_delta = l_event->event_time - CCP_Timebase_Now(_ccp_obj);
+        
+        if((sint32)l_delta < (sint32)CCP_COMPARE_SCHEDULER_MIN_LEAD_TICKS)
+        {
+            /* @Brief : Too close or past, the event is done at once on the pin latch. */
+            _scheduler->pin_logic = l_next_logic;
+            gpio_pin_write_logic(&(_ccp_obj->ccp_pin), _scheduler->pin_logic);
+            _scheduler->late_events++;
+            _scheduler->head = (uint8)((_scheduler->head + 1) & CCP_COMPARE_SCHEDULER_INDEX_MASK);
+            _scheduler->count--;
+        }
+        else
+        {
+            if(CCP1_INST == _ccp_obj->ccp_inst)
+            {
+                CCPR1L = (uint8)(l_event->event_time);
+                CCPR1H = (uint8)(l_event->event_time >> 8);
+            }
+            else
+            {
+                CCPR2L = (uint8)(l_event->event_time);
+                CCPR2H = (uint8)(l_event->event_time >> 8);
+            }
+            
+            /* 
+             * @Brief : SET_PIN_LOW starts the compare output low and drives it high on the match,
+             *          SET_PIN_HIGH starts it high and drives it low, so entering the mode keeps the pin logic.
+             *          A far event, or an event that keeps the pin logic, only raises the interrupt.
+             */
+            if(l_delta > CCP_COMPARE_SCHEDULER_ARM_LIMIT)
+            {
+                l_mode = CCP_COMPARE_MODE_GEN_SW_INTERRUPT;
+            }
+            else
+            {
+                _scheduler->event_armed = STD_ACTIVE;
+                if(l_next_logic == _scheduler->pin_logic)
+                {
+                    l_mode = CCP_COMPARE_MODE_GEN_SW_INTERRUPT;
+                }
+                else if(GPIO_HIGH == l_next_logic)
+                {
+                    l_mode = CCP_COMPARE_MODE_SET_PIN_LOW;
+                }
+                else
+                {
+                    l_mode = CCP_COMPARE_MODE_SET_PIN_HIGH;
+                }
+            }
+        }
+    }
+    
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCP1_SET_MODE(l_mode);
+        CCP1_InterruptFlagClear();
+    }
+    else
+    {
+        CCP2_SET_MODE(l_mode);
+        CCP2_InterruptFlagClear();
+    }
+}
+#endif
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE) || \
+    (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) || (CCP_SERVO_CFG==CONFIG_ENABLE)
+/*
+ * @Brief          : To read the 16-Bit timer of CCP1 or CCP2 Capture and Compare modes.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Return 16-Bit timer value.
+ */
+static uint16 CCP_Timebase_Read(const ccp_t *_ccp_obj)
+{
+    uint16 l_timer = ZERO_INT;
+    
+    /* @Brief : Reading the low byte latches the high byte in 16-Bit read/write mode. */
+    if(CCP_TIMEBASE_IS_TIMER3(_ccp_obj->ccp_inst))
+    {
+        l_timer = (uint16)TMR3L;
+        l_timer |= (uint16)((uint16)TMR3H << 8);
+    }
+    else
+    {
+        l_timer = (uint16)TMR1L;
+        l_timer |= (uint16)((uint16)TMR1H << 8);
+    }
+    return l_timer;
+}
+#endif
+
+#if CCP_SOFT_PWM_CFG==CONFIG_ENABLE
+/*
+ * @Brief           : To sort the duty cycles into a period schedule.
+ * @Param _soft_pwm : Pointer to the software PWM configurations.
+ * @Param _state    : Pointer to the software PWM state.
+ * @Param _schedule : Pointer to the schedule to build.
+ */
+static void CCP_Soft_PWM_Build(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state, 
+                               ccp_soft_pwm_schedule_t *_schedule)
+{
+    uint8 l_order[CCP_SOFT_PWM_CFG_MAX_CHANNELS];
+    uint8 l_sorted = ZERO_INT;
+    uint8 l_channel = ZERO_INT;
+    uint8 l_position = ZERO_INT;
+    uint8 l_duty = ZERO_INT;
+    uint8 l_port = ZERO_INT;
+    uint8 l_pin_mask = ZERO_INT;
+    ccp_soft_pwm_edge_t *l_edge = NULL;
+    
+    for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+    {
+        _schedule->used_masks[l_port] = ZERO_INT;
+        _schedule->on_masks[l_port] = ZERO_INT;
+    }
+    
+    /* @Brief : Insertion sort of the channels that have a falling edge inside the period. */
+    for(l_channel = ZERO_INT; l_channel < _soft_pwm->soft_pwm_channels_number; l_channel++)
+    {
+        l_duty = _state->duty[l_channel];
+        l_port = _soft_pwm->soft_pwm_channels[l_channel].port;
+        l_pin_mask = (uint8)(BIT_MASK << _soft_pwm->soft_pwm_channels[l_channel].pin);
+        _schedule->used_masks[l_port] |= l_pin_mask;
+        if(CCP_SOFT_PWM_DUTY_MIN != l_duty)
+        {
+            _schedule->on_masks[l_port] |= l_pin_mask;
+        }
+        else{/*****Nothing*****/}
+        if((CCP_SOFT_PWM_DUTY_MIN != l_duty) && (CCP_SOFT_PWM_DUTY_MAX != l_duty))
+        {
+            l_position = l_sorted;
+            while((l_position > ZERO_INT) && (_state->duty[l_order[l_position - 1]] > l_duty))
+            {
+                l_order[l_position] = l_order[l_position - 1];
+                l_position--;
+            }
+            l_order[l_position] = l_channel;
+            l_sorted++;
+        }
+        else{/*****Nothing*****/}
+    }
+    
+    /* @Brief : Channels of the same duty cycle are merged into one edge. */
+    _schedule->edges_number = ZERO_INT;
+    for(l_position = ZERO_INT; l_position < l_sorted; l_position++)
+    {
+        l_channel = l_order[l_position];
+        if((ZERO_INT == l_position) || (_state->duty[l_order[l_position - 1]] != _state->duty[l_channel]))
+        {
+            l_edge = &(_schedule->edges[_schedule->edges_number]);
+            _schedule->edges_number++;
+            l_edge->edge_offset = (uint16)((uint16)_state->duty[l_channel] * CCP_SOFT_PWM_CFG_STEP_TICKS);
+            for(l_port = ZERO_INT; l_port < PORT_MAX_NUMBER; l_port++)
+            {
+                l_edge->edge_masks[l_port] = ZERO_INT;
+            }
+        }
+        else{/*****Nothing*****/}
+        l_edge->edge_masks[_soft_pwm->soft_pwm_channels[l_channel].port] |= 
+                (uint8)(BIT_MASK << _soft_pwm->soft_pwm_channels[l_channel].pin);
+    }
+}
+#endif
+
+#if (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) || (CCP_SERVO_CFG==CONFIG_ENABLE)
+/*
+ * @Brief          : To write the CCP1 or CCP2 compare value.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ * @Param _value   : 16-Bit compare value.
+ */
+static void CCP_Write_Compare(const ccp_t *_ccp_obj, uint16 _value)
+{
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCPR1L = (uint8)(_value);
+        CCPR1H = (uint8)(_value >> 8);
+    }
+    else
+    {
+        CCPR2L = (uint8)(_value);
+        CCPR2H = (uint8)(_value >> 8);
+    }
+}
+#endif
+
+/*
+ * @Brief          : To enable or disable the interrupt feature for CCP1 or CCP2.
+ * @Param _ccp_obj : Pointer to the CCP module configurations.
+ */
+static void CCP_Interrupt_Config(const ccp_t *_ccp_obj)
+{
+    /* @Brief : CCP1 Interrupt configuration. */ 
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    CCP1_InterruptEnable();
+    CCP1_InterruptFlagClear();
+    CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
+        
+    /* @Brief : CCP1 Priority configuration. */ 
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    INTERRUPT_PriorityLevelsEnable(); 
+    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority)
+    {
+        INTERRUPT_GlobalInterruptHighEnable();
+        CCP1_HighPrioritySet();
+    }
+    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority)
+    {
+        INTERRUPT_GlobalInterruptLowEnable();
+        CCP1_LowPrioritySet();
     }
     else{/*****Nothing*****/}
 #else
@@ -507,26 +2213,8 @@ static void CCP_Interrupt_Config(const ccp_t *_ccp_obj)
  */
 static void CCP_Mode_Timer_Selection(const ccp_t *_ccp_obj)
 {
-    if(CCP1_CCP2_TIMER3 == _ccp_obj->ccp_capture_timer)
-    {
-        /* @Brief : Timer3 is the Capture clock source for the CCP module. */
-        T3CONbits.T3CCP1 = 0;
-        T3CONbits.T3CCP2 = 1;
-    }
-    
-    else if (CCP1_TIMER1_CCP2_TIMER3 == _ccp_obj->ccp_capture_timer)
-    {
-        /* @Brief : Timer1 is the Capture clock source for the CCP1 and Timer3 for the CCP2 module. */
-        T3CONbits.T3CCP1 = 1;
-        T3CONbits.T3CCP2 = 0;
-    }
-    else if (CCP1_CCP2_TIMER1 == _ccp_obj->ccp_capture_timer)
-    {
-        /* @Brief : Timer1 is the Capture clock source for the CCP module. */
-        T3CONbits.T3CCP1 = 0;
-        T3CONbits.T3CCP2 = 0;
-    }
-    else{/*****Nothing*****/}
+    /* @Brief : Timer1 or Timer3 is the Capture or Compare clock source for the CCP1 and CCP2 modules. */
+    (void)CCP_Set_Timebase(_ccp_obj->ccp_capture_timer);
 }
 
 /*
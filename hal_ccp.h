@@ -75,6 +75,65 @@
 #define CCP_TIMER2_PRESCALER_DIV_BY_1        1
 #define CCP_TIMER2_PRESCALER_DIV_BY_4        4
 #define CCP_TIMER2_PRESCALER_DIV_BY_16       16
+
+/* @Brief : Macros for the ECCP1 PWM outputs configuration (P1M bits). */
+#define CCP_ECCP_SINGLE_OUTPUT               0x00
+#define CCP_ECCP_FULL_BRIDGE_FORWARD         0x01
+#define CCP_ECCP_HALF_BRIDGE                 0x02
+#define CCP_ECCP_FULL_BRIDGE_REVERSE         0x03
+
+/* @Brief : Macros for the ECCP1 PWM outputs polarity, used as CCP1 PWM mode variant. */
+#define CCP_ECCP_PWM_AC_HIGH_BD_HIGH         ((uint8)0x0C)
+#define CCP_ECCP_PWM_AC_HIGH_BD_LOW          ((uint8)0x0D)
+#define CCP_ECCP_PWM_AC_LOW_BD_HIGH          ((uint8)0x0E)
+#define CCP_ECCP_PWM_AC_LOW_BD_LOW           ((uint8)0x0F)
+
+/* @Brief : Macros for the ECCP1 auto-shutdown source. */
+#define CCP_ECCP_SHUTDOWN_DISABLED           0x00
+#define CCP_ECCP_SHUTDOWN_COMPARATOR1        0x01
+#define CCP_ECCP_SHUTDOWN_COMPARATOR2        0x02
+#define CCP_ECCP_SHUTDOWN_COMPARATORS        0x03
+#define CCP_ECCP_SHUTDOWN_FLT0               0x04
+#define CCP_ECCP_SHUTDOWN_FLT0_COMPARATOR1   0x05
+#define CCP_ECCP_SHUTDOWN_FLT0_COMPARATOR2   0x06
+#define CCP_ECCP_SHUTDOWN_FLT0_COMPARATORS   0x07
+
+/* @Brief : Macros for the ECCP1 pins state while shut down. */
+#define CCP_ECCP_SHUTDOWN_DRIVE_LOW          0x00
+#define CCP_ECCP_SHUTDOWN_DRIVE_HIGH         0x01
+#define CCP_ECCP_SHUTDOWN_TRI_STATE          0x02
+
+/* @Brief : Macros for the ECCP1 auto-shutdown status. */
+#define CCP_ECCP_SHUTDOWN_ACTIVE             0x01
+#define CCP_ECCP_SHUTDOWN_INACTIVE           0x00
+
+/* @Brief : Macro for the PWM duty cycle full scale in per-mille. */
+#define CCP_PWM_DUTY_PERMILLE_FULL_SCALE     1000
+/* @Brief : Macro for the PWM duty cycle full scale as Q15 fraction (1.0). */
+#define CCP_PWM_DUTY_Q15_FULL_SCALE          0x8000
+
+/* @Brief : Macros for the output compare scheduler event actions, the CCP pin logic after the event. */
+#define CCP_COMPARE_EVENT_PIN_LOW            0x00
+#define CCP_COMPARE_EVENT_PIN_HIGH           0x01
+#define CCP_COMPARE_EVENT_PIN_TOGGLE         0x02
+
+/* @Brief : Macros for the software PWM duty cycle steps, 0 is always off and 255 is always on. */
+#define CCP_SOFT_PWM_DUTY_MIN                0
+#define CCP_SOFT_PWM_DUTY_MAX                255
+/* @Brief : Macro for the software PWM period in timebase ticks. */
+#define CCP_SOFT_PWM_PERIOD_TICKS            ((uint16)(CCP_SOFT_PWM_DUTY_MAX * CCP_SOFT_PWM_CFG_STEP_TICKS))
+
+/* @Brief : Macros for the servo frame and the centre pulse. */
+#define CCP_SERVO_FRAME_TICKS                ((uint16)(CCP_SERVO_CFG_FRAME_US * CCP_SERVO_CFG_TICKS_PER_US))
+#define CCP_SERVO_CENTRE_PULSE_US            ((uint16)((CCP_SERVO_CFG_MIN_PULSE_US + CCP_SERVO_CFG_MAX_PULSE_US) / 2))
+
+/* @Brief : Macro for the DDS samples middle value, the output of a 0 Hz frequency. */
+#define CCP_DDS_SAMPLE_MIDDLE                128
+/*
+ * @Brief : Macro for the highest DDS sample rate, the samples take at most half of the instruction cycles
+ *          (4000 samples per second at 8 MHz). The frequency steps computation needs it below 0xFFFF.
+ */
+#define CCP_DDS_MAX_SAMPLE_RATE              (((_XTAL_FREQ) / 4) / (2 * CCP_DDS_CFG_SAMPLE_CYCLES))
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
@@ -83,6 +142,98 @@
 
 /* @Brief : Macro function to select CCP2 mode. */
 #define CCP2_SET_MODE(_CONFIG) (CCP2CONbits.CCP2M = _CONFIG)
+
+/* @Brief : Macro function to check if CCP1 or CCP2 (_INST) Capture or Compare modes run on Timer3. */
+#define CCP_TIMEBASE_IS_TIMER3(_INST)  ((T3CONbits.T3CCP2) || ((CCP2_INST == (_INST)) && (T3CONbits.T3CCP1)))
+
+/* @Brief : Macro function for the PWM period in Timer2 counts (PR2 + 1) nearest to _FREQ with pre-scaler _PRE. */
+#define CCP_PWM_PLAN_PERIOD_FOR(_FREQ, _PRE)  (((_XTAL_FREQ) + (2 * (_PRE) * (_FREQ))) / (4 * (_PRE) * (_FREQ)))
+
+/* @Brief : Macro function for the whole duty cycle resolution bits of a period of _TICKS duty cycle ticks. */
+#define CCP_PWM_RESOLUTION_BITS(_TICKS)       (((_TICKS) >= 1024) ? 10 : ((_TICKS) >= 512) ? 9 : \
+                                               ((_TICKS) >= 256) ? 8 : ((_TICKS) >= 128) ? 7 : \
+                                               ((_TICKS) >= 64) ? 6 : ((_TICKS) >= 32) ? 5 : \
+                                               ((_TICKS) >= 16) ? 4 : ((_TICKS) >= 8) ? 3 : 2)
+
+#if (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE) && ((CCP1_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE) || \
+                                                    (CCP2_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE))
+#error "CCP_COMPARE_SCHEDULER_CFG needs the CCP1 and CCP2 interrupt features."
+#endif
+
+#if (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) && ((CCP1_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE) || \
+                                         (CCP2_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE))
+#error "CCP_SOFT_PWM_CFG needs the CCP1 and CCP2 interrupt features."
+#endif
+
+#if (CCP_SOFT_PWM_CFG==CONFIG_ENABLE) && ((CCP_SOFT_PWM_CFG_STEP_TICKS * 255UL) > 0xFFFFUL)
+#error "CCP_SOFT_PWM_CFG_STEP_TICKS makes the software PWM period longer than the 16-Bit timebase."
+#endif
+
+#if (CCP_SERVO_CFG==CONFIG_ENABLE) && ((CCP1_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE) || \
+                                      (CCP2_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE))
+#error "CCP_SERVO_CFG needs the CCP1 and CCP2 interrupt features."
+#endif
+
+#if (CCP_SERVO_CFG==CONFIG_ENABLE) && ((CCP_SERVO_CFG_FRAME_US * CCP_SERVO_CFG_TICKS_PER_US) > 0xFFFFUL)
+#error "CCP_SERVO_CFG_FRAME_US is longer than the 16-Bit timebase."
+#endif
+
+#if (CCP_SERVO_CFG==CONFIG_ENABLE) && ((CCP_SERVO_CFG_MAX_SERVOS * CCP_SERVO_CFG_MAX_PULSE_US) >= CCP_SERVO_CFG_FRAME_US)
+#error "CCP_SERVO_CFG_MAX_SERVOS longest pulses do not fit in one servo frame."
+#endif
+
+#if (CCP_DDS_CFG==CONFIG_ENABLE) && (CCP1_CFG_SELECTED_MODE!=CCP_CFG_PWM_MODE_SELECTED) && \
+                                    (CCP2_CFG_SELECTED_MODE!=CCP_CFG_PWM_MODE_SELECTED)
+#error "CCP_DDS_CFG needs CCP1 or CCP2 in PWM mode."
+#endif
+
+#if (CCP_DDS_CFG==CONFIG_ENABLE) && (TIMER2_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE)
+#error "CCP_DDS_CFG needs the Timer2 interrupt feature."
+#endif
+
+#if (CCP_DDS_CFG==CONFIG_ENABLE) && (CCP_DDS_MAX_SAMPLE_RATE > 0xFFFFUL)
+#error "CCP_DDS_MAX_SAMPLE_RATE is above the 0xFFFF of the DDS frequency steps computation."
+#endif
+
+#if (CCP1_ECCP_CFG==CONFIG_ENABLE) && (CCP1_CFG_SELECTED_MODE!=CCP_CFG_PWM_MODE_SELECTED)
+#error "CCP1_ECCP_CFG needs CCP1_CFG_SELECTED_MODE set to CCP_CFG_PWM_MODE_SELECTED."
+#endif
+
+#if CCP_PWM_PLANNER_CFG==CONFIG_ENABLE
+/* 
+ * @Brief : Compile-time PWM frequency planner.
+ *          The smallest Timer2 pre-scaler that still fits PR2 gives the longest period,
+ *          so it gives the most duty cycle bits for CCP_PWM_CFG_TARGET_FREQUENCY.
+ */
+#define CCP_PWM_PLAN_PRESCALER        ((CCP_PWM_PLAN_PERIOD_FOR(CCP_PWM_CFG_TARGET_FREQUENCY, 1) <= 256) ? 1 : \
+                                       (CCP_PWM_PLAN_PERIOD_FOR(CCP_PWM_CFG_TARGET_FREQUENCY, 4) <= 256) ? 4 : 16)
+/* @Brief : Planned Timer2 T2CKPS bits value @Ref : TIMER2_PRESCALER_DIV_BY_x. */
+#define CCP_PWM_PLAN_T2CKPS           ((1 == CCP_PWM_PLAN_PRESCALER) ? 0 : (4 == CCP_PWM_PLAN_PRESCALER) ? 1 : 2)
+/* @Brief : Planned PWM period in Timer2 counts and PR2 value. */
+#define CCP_PWM_PLAN_PERIOD           CCP_PWM_PLAN_PERIOD_FOR(CCP_PWM_CFG_TARGET_FREQUENCY, CCP_PWM_PLAN_PRESCALER)
+#define CCP_PWM_PLAN_PR2              (CCP_PWM_PLAN_PERIOD - 1)
+/* @Brief : Achieved PWM frequency in Hz. */
+#define CCP_PWM_PLAN_FREQUENCY        ((_XTAL_FREQ) / (4 * CCP_PWM_PLAN_PRESCALER * CCP_PWM_PLAN_PERIOD))
+/* @Brief : Achieved duty cycle resolution, in duty cycle ticks (100 %) and in whole bits. */
+#define CCP_PWM_PLAN_DUTY_TICKS       (4 * CCP_PWM_PLAN_PERIOD)
+#define CCP_PWM_PLAN_RESOLUTION_BITS  CCP_PWM_RESOLUTION_BITS(CCP_PWM_PLAN_DUTY_TICKS)
+/* @Brief : Achieved PWM frequency error in Hz. */
+#define CCP_PWM_PLAN_FREQUENCY_ERROR  ((CCP_PWM_PLAN_FREQUENCY > CCP_PWM_CFG_TARGET_FREQUENCY) ? \
+                                       (CCP_PWM_PLAN_FREQUENCY - CCP_PWM_CFG_TARGET_FREQUENCY) : \
+                                       (CCP_PWM_CFG_TARGET_FREQUENCY - CCP_PWM_PLAN_FREQUENCY))
+
+#if (CCP_PWM_CFG_TARGET_FREQUENCY == 0)
+#error "CCP PWM planner : CCP_PWM_CFG_TARGET_FREQUENCY must not be 0."
+#elif (CCP_PWM_PLAN_PERIOD_FOR(CCP_PWM_CFG_TARGET_FREQUENCY, 16) > 256)
+#error "CCP PWM planner : CCP_PWM_CFG_TARGET_FREQUENCY is too low for Timer2 at this _XTAL_FREQ."
+#elif (CCP_PWM_PLAN_PERIOD_FOR(CCP_PWM_CFG_TARGET_FREQUENCY, 1) < 1)
+#error "CCP PWM planner : CCP_PWM_CFG_TARGET_FREQUENCY is too high for Timer2 at this _XTAL_FREQ."
+#elif (CCP_PWM_PLAN_RESOLUTION_BITS < CCP_PWM_CFG_MIN_RESOLUTION_BITS)
+#error "CCP PWM planner : duty cycle resolution is below CCP_PWM_CFG_MIN_RESOLUTION_BITS."
+#elif ((CCP_PWM_PLAN_FREQUENCY_ERROR * 1000) > (CCP_PWM_CFG_FREQUENCY_TOLERANCE_PERMILLE * CCP_PWM_CFG_TARGET_FREQUENCY))
+#error "CCP PWM planner : achieved frequency is out of CCP_PWM_CFG_FREQUENCY_TOLERANCE_PERMILLE."
+#endif
+#endif
 /***********************************************************************/
 
 /********************Data Types Declarations-Section********************/
@@ -122,10 +273,66 @@ typedef union
     };
     struct
     {
-       uint8 ccpr_16bit;   /* @Brief : Read CCPR as 16-Bit register value. */
+       uint16 ccpr_16bit;  /* @Brief : Read CCPR as 16-Bit register value. */
     };
 }CCP_REG_T;
 
+#if CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE
+/* @Brief : One input capture measurement in capture timebase ticks. */
+typedef struct
+{
+    uint32 high_time;                  /* @Brief : Time from a rising edge to the next falling edge. */
+    uint32 low_time;                   /* @Brief : Time from the falling edge to the next rising edge. */
+    uint32 period;                     /* @Brief : Time between the two rising edges. */
+}ccp_capture_sample_t;
+
+/* @Brief : Input capture statistics over the measurements kept by the engine. */
+typedef struct
+{
+    uint32 period_min;                 /* @Brief : Shortest period. */
+    uint32 period_max;                 /* @Brief : Longest period. */
+    uint32 period_avg;                 /* @Brief : Average period. */
+    uint32 high_time_min;              /* @Brief : Shortest high time. */
+    uint32 high_time_max;              /* @Brief : Longest high time. */
+    uint32 high_time_avg;              /* @Brief : Average high time. */
+    uint16 duty_permille;              /* @Brief : Average duty cycle in per-mille. */
+    uint8 samples_number;              /* @Brief : Number of measurements used. */
+}ccp_capture_stats_t;
+
+/* @Brief : Input capture engine state, one for each CCP in capture mode. */
+typedef struct
+{
+    ccp_capture_sample_t samples[CCP_CAPTURE_ENGINE_BUFFER_SIZE];  /* @Brief : Ring of the last measurements. */
+    uint32 last_rise;                  /* @Brief : 32-Bit time of the last rising edge. */
+    uint32 last_fall;                  /* @Brief : 32-Bit time of the last falling edge. */
+    volatile uint8 head;               /* @Brief : Index of the next measurement to write. */
+    volatile uint8 count;              /* @Brief : Number of valid measurements. */
+    volatile uint8 sequence;           /* @Brief : Incremented by every written measurement. */
+    uint8 phase;                       /* @Brief : Edge expected next. */
+}ccp_capture_engine_t;
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/* @Brief : One output compare event. */
+typedef struct
+{
+    uint32 event_time;                 /* @Brief : 32-Bit timebase time of the event. */
+    uint8 event_action;                /* @Brief : CCP pin action, @Ref : CCP_COMPARE_EVENT_PIN_x. */
+}ccp_compare_event_t;
+
+/* @Brief : Output compare scheduler state, one for each CCP used by the scheduler. */
+typedef struct
+{
+    ccp_compare_event_t events[CCP_COMPARE_SCHEDULER_QUEUE_SIZE];  /* @Brief : Pending events sorted by time. */
+    volatile uint8 head;               /* @Brief : Index of the next event. */
+    volatile uint8 count;              /* @Brief : Number of pending events. */
+    volatile uint8 late_events;        /* @Brief : Events too close to be armed, done by software. */
+    uint8 pin_logic : 1;               /* @Brief : CCP pin logic, @Ref : logic_t. */
+    uint8 event_armed : 1;             /* @Brief : The head event is armed on the CCP, not a wake-up. */
+    uint8 reserved : 6;
+}ccp_compare_scheduler_t;
+#endif
+
 /* #Brief : CCP configuration. */
 typedef struct
 {
@@ -147,7 +354,89 @@ typedef struct
     uint8 timer2_postscaler_value : 4;          /* @Brief : CCP1 or CCP2 Timer2 Post-scaler configuration. */  
     uint8 timer2_prescaler_value : 2;           /* @Brief : CCP1 or CCP2 Timer2 Pre-scaler configuration. */  
 #endif
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+    uint8 eccp_output_mode : 2;                 /* @Brief : ECCP1 outputs configuration @Ref : CCP_ECCP_x (P1M). */
+    uint8 eccp_shutdown_source : 3;             /* @Brief : ECCP1 auto-shutdown source @Ref : CCP_ECCP_SHUTDOWN_x. */
+    uint8 eccp_auto_restart : 1;                /* @Brief : ECCP1 restarts by itself once the shutdown source is gone. */
+    uint8 eccp_shutdown_state_ac : 2;           /* @Brief : P1A and P1C state while shut down @Ref : CCP_ECCP_SHUTDOWN_DRIVE_x. */
+    uint8 eccp_shutdown_state_bd : 2;           /* @Brief : P1B and P1D state while shut down @Ref : CCP_ECCP_SHUTDOWN_DRIVE_x. */
+    uint8 eccp_dead_band : 7;                   /* @Brief : Half-bridge dead-band delay in instruction cycles. */
+#endif
 }ccp_t;
+
+#if CCP_SOFT_PWM_CFG==CONFIG_ENABLE
+/* @Brief : Software PWM configuration. */
+typedef struct
+{
+    const ccp_t *soft_pwm_ccp;                   /* @Brief : CCP1 or CCP2 compare channel timing the edges. */
+    const pin_config_t *soft_pwm_channels;       /* @Brief : Channel pins. */
+    uint8 soft_pwm_channels_number;              /* @Brief : Number of channels, up to CCP_SOFT_PWM_CFG_MAX_CHANNELS. */
+}ccp_soft_pwm_t;
+
+/* @Brief : One software PWM falling edge, the channels of the same duty cycle share it. */
+typedef struct
+{
+    uint16 edge_offset;                          /* @Brief : Timebase ticks from the period start. */
+    uint8 edge_masks[PORT_MAX_NUMBER];           /* @Brief : Pins cleared by the edge on each port. */
+}ccp_soft_pwm_edge_t;
+
+/* @Brief : Software PWM period schedule, edges sorted by offset. */
+typedef struct
+{
+    ccp_soft_pwm_edge_t edges[CCP_SOFT_PWM_CFG_MAX_CHANNELS];
+    uint8 used_masks[PORT_MAX_NUMBER];           /* @Brief : Channel pins on each port. */
+    uint8 on_masks[PORT_MAX_NUMBER];             /* @Brief : Pins set at the period start on each port. */
+    uint8 edges_number;
+}ccp_soft_pwm_schedule_t;
+
+/* @Brief : Software PWM state, the interrupt plays one schedule while the other is built. */
+typedef struct
+{
+    ccp_soft_pwm_schedule_t schedules[2];
+    uint8 duty[CCP_SOFT_PWM_CFG_MAX_CHANNELS];   /* @Brief : Channel duty cycle steps. */
+    uint16 period_start;                         /* @Brief : 16-Bit timebase time of the period start. */
+    uint8 next_edge;                             /* @Brief : Edge armed on the CCP, edges_number is the period end. */
+    volatile uint8 active_schedule;              /* @Brief : Schedule played by the interrupt. */
+    volatile uint8 schedule_pending;             /* @Brief : The other schedule is taken at the next period start. */
+    volatile uint8 duty_changed;                 /* @Brief : A duty cycle changed since the last build. */
+}ccp_soft_pwm_state_t;
+#endif
+
+#if CCP_SERVO_CFG==CONFIG_ENABLE
+/* @Brief : Servo driver configuration. */
+typedef struct
+{
+    const ccp_t *servo_ccp;                      /* @Brief : CCP1 or CCP2 compare channel timing the slots. */
+    const pin_config_t *servo_pins;              /* @Brief : Servo signal pins. */
+    uint8 servos_number;                         /* @Brief : Number of servos, up to CCP_SERVO_CFG_MAX_SERVOS. */
+}ccp_servo_t;
+
+/* @Brief : Servo driver state, the interrupt plays one pulse buffer while the other is written. */
+typedef struct
+{
+    uint16 pulse_ticks[2][CCP_SERVO_CFG_MAX_SERVOS];  /* @Brief : Pulse widths in timebase ticks. */
+    uint16 requested_ticks[CCP_SERVO_CFG_MAX_SERVOS]; /* @Brief : Pulse widths set since the last update. */
+    uint16 frame_start;                          /* @Brief : 16-Bit timebase time of the frame start. */
+    uint16 slot_time;                            /* @Brief : 16-Bit timebase time of the armed slot edge. */
+    uint8 slot;                                  /* @Brief : Servo pulsing, servos_number is the frame gap. */
+    volatile uint8 active_buffer;                /* @Brief : Pulse buffer played by the interrupt. */
+    volatile uint8 buffer_pending;               /* @Brief : The other buffer is taken at the next frame start. */
+    volatile uint8 pulses_changed;               /* @Brief : A pulse width changed since the last update. */
+}ccp_servo_state_t;
+#endif
+
+#if CCP_DDS_CFG==CONFIG_ENABLE
+/* @Brief : Direct digital synthesis sine generator state. */
+typedef struct
+{
+    uint32 phase;                                /* @Brief : Phase accumulator, one sine period is 2^32. */
+    volatile uint32 phase_step;                  /* @Brief : Phase added each sample, sets the output frequency. */
+    uint32 sample_rate;                          /* @Brief : Timer2 interrupts per second, computed at init. */
+    uint32 step_per_hz;                          /* @Brief : Integer part of 2^32 / sample_rate. */
+    uint32 step_per_hz_rest;                     /* @Brief : Remainder of 2^32 / sample_rate. */
+    uint16 duty_scale;                           /* @Brief : PR2 + 1, a sample times duty_scale / 64 is its duty cycle ticks. */
+}ccp_dds_t;
+#endif
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -169,7 +458,18 @@ Std_ReturnType CCP_Init(const ccp_t *_ccp_obj);
  */
 Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj);
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
+/*
+ * @Brief               : To move CCP1 and CCP2 Capture and Compare modes between Timer1 and Timer3 at runtime.
+ * @Param _ccp_timebase : CCP1 and CCP2 timer selection @Ref : ccp_capture_timer_t.
+ * @Note                : Both select bits are written at once, so no other pairing is seen in between.
+ *                        The CCP modes, compare values and interrupts are kept.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_Timebase(ccp_capture_timer_t _ccp_timebase);
+
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
 /*
  * @Brief                 : To check Capture mode data status.
  * @Param _capture_status : Pointer to the CCP Capture mode data status.
@@ -181,15 +481,17 @@ Std_ReturnType CCP_IsCapturedDataReady(uint8 *_capture_status);
 
 /*
  * @Brief               : To read Capture mode value.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations. 
  * @Param capture_value : Pointer to the CCP Capture mode value.
+ * @Note                : The value is coherent even when a new capture lands while it is read.
  * @Return Status of the function.
  *          (E_OK)      : The function done successfully.
  *          (E_NOT_OK)  : The function has issue while performing this action.
  */
-Std_ReturnType CCP_Read_Capture_Mode_Value(uint16 *capture_value);
+Std_ReturnType CCP_Read_Capture_Mode_Value(const ccp_t *_ccp_obj, uint16 *capture_value);
 #endif
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
 /*
  * @Brief                 : To check Compare mode Compare status if completed or not.
  * @Param _compare_status : Pointer to the CCP Compare mode data status.
@@ -210,16 +512,46 @@ Std_ReturnType CCP_IsCompareCompleted(uint8 *_compare_status);
 Std_ReturnType CCP_Set_Compare_Mode_Value(const ccp_t *_ccp_obj, uint16 compare_value);    
 #endif
 
-#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+#if(CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)|| (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
 /*
  * @Brief               : To set duty cycle for PWM mode.
  * @Param _ccp_obj      : Pointer to the CCP module configurations.
- * @Param _duty 
+ * @Param _duty         : Duty cycle in percent (0 : 100).
  * @Return Status of the function.
  *          (E_OK)      : The function done successfully.
  *          (E_NOT_OK)  : The function has issue while performing this action.
  */
 Std_ReturnType CCP_Set_PWM_Duty(const ccp_t *_ccp_obj, const uint16 _duty);
+
+/*
+ * @Brief               : To set duty cycle for PWM mode as raw 10-Bit value.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _duty_raw     : Duty cycle in Timer2 input clocks, 4 * (PR2 + 1) is 100 %.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Raw(const ccp_t *_ccp_obj, const uint16 _duty_raw);
+
+/*
+ * @Brief                : To set duty cycle for PWM mode in per-mille.
+ * @Param _ccp_obj       : Pointer to the CCP module configurations.
+ * @Param _duty_permille : Duty cycle in per-mille (0 : CCP_PWM_DUTY_PERMILLE_FULL_SCALE).
+ * @Return Status of the function.
+ *          (E_OK)       : The function done successfully.
+ *          (E_NOT_OK)   : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Permille(const ccp_t *_ccp_obj, const uint16 _duty_permille);
+
+/*
+ * @Brief               : To set duty cycle for PWM mode as Q15 fraction.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _duty_q15     : Duty cycle as Q15 fraction (0 : CCP_PWM_DUTY_Q15_FULL_SCALE).
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Set_PWM_Duty_Q15(const ccp_t *_ccp_obj, const uint16 _duty_q15);
     
 /*
  * @Brief               : To start PWM mode.
@@ -239,6 +571,272 @@ Std_ReturnType CCP_Start_PWM(const ccp_t *_ccp_obj);
  */
 Std_ReturnType CCP_Stop_PWM(const ccp_t *_ccp_obj);
 #endif
+
+#if (CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE) || (CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE)
+/*
+ * @Brief : To count a Timer1 overflow for the 32-Bit CCP times, called from the Timer1 interrupt handler.
+ */
+void CCP_Timebase_Timer1_Overflow(void);
+
+/*
+ * @Brief : To count a Timer3 overflow for the 32-Bit CCP times, called from the Timer3 interrupt handler.
+ */
+void CCP_Timebase_Timer3_Overflow(void);
+#endif
+
+#if CCP_CAPTURE_ENGINE_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To start the input capture engine of CCP1 or CCP2 on the next rising edge.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Capture_Engine_Init(const ccp_t *_ccp_obj, ccp_capture_engine_t *_engine);
+
+/*
+ * @Brief               : To time-stamp the captured edge and switch the edge polarity,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _engine       : Pointer to the input capture engine state.
+ */
+void CCP_Capture_Engine_ISR(const ccp_t *_ccp_obj, ccp_capture_engine_t *_engine);
+
+/*
+ * @Brief               : To read the last input capture measurement.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Param _sample       : Pointer to the last measurement.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : No measurement yet or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Capture_Engine_Get_Last(ccp_capture_engine_t *_engine, ccp_capture_sample_t *_sample);
+
+/*
+ * @Brief               : To compute the minimum, maximum and average over the kept measurements.
+ * @Param _engine       : Pointer to the input capture engine state.
+ * @Param _stats        : Pointer to the statistics.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : No measurement yet or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Capture_Engine_Get_Stats(ccp_capture_engine_t *_engine, ccp_capture_stats_t *_stats);
+#endif
+
+#if CCP_COMPARE_SCHEDULER_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To start an empty output compare scheduler on CCP1 or CCP2.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ * @Param _pin_logic    : CCP pin logic until the first event.
+ * @Note                : The CCP pin is an output and the timebase runs in 16-Bit read/write mode.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Init(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler, logic_t _pin_logic);
+
+/*
+ * @Brief               : To queue an output event at an absolute timebase time.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ * @Param _event_time   : 32-Bit timebase time of the event, less than 2^31 ticks ahead.
+ * @Param _event_action : CCP pin action @Ref : CCP_COMPARE_EVENT_PIN_x.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The queue is full or the function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Add(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler, 
+                                         uint32 _event_time, uint8 _event_action);
+
+/*
+ * @Brief               : To read the 32-Bit timebase time of CCP1 or CCP2, the reference for the event times.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _time         : Pointer to the 32-Bit timebase time.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Compare_Scheduler_Now(const ccp_t *_ccp_obj, uint32 *_time);
+
+/*
+ * @Brief               : To complete the armed event and arm the next one,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _scheduler    : Pointer to the output compare scheduler state.
+ */
+void CCP_Compare_Scheduler_ISR(const ccp_t *_ccp_obj, ccp_compare_scheduler_t *_scheduler);
+#endif
+
+#if CCP_SOFT_PWM_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the software PWM channels off and start the period timing.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Note                : The CCP is initialized in Compare mode with its interrupt and a free running timebase.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Init(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state);
+
+/*
+ * @Brief               : To set the duty cycle of one software PWM channel.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Param _channel      : Channel index in the configuration pins.
+ * @Param _duty         : Duty cycle steps from CCP_SOFT_PWM_DUTY_MIN to CCP_SOFT_PWM_DUTY_MAX.
+ * @Note                : The new duty cycles are output after CCP_Soft_PWM_Update, at a period start.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Set_Duty(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state, 
+                                     uint8 _channel, uint8 _duty);
+
+/*
+ * @Brief               : To sort the changed duty cycles into the next period schedule, called from the main loop.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Soft_PWM_Update(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state);
+
+/*
+ * @Brief               : To output the due edges and arm the next one, called from the CCP1 or CCP2 interrupt handler.
+ * @Param _soft_pwm     : Pointer to the software PWM configurations.
+ * @Param _state        : Pointer to the software PWM state.
+ */
+void CCP_Soft_PWM_ISR(const ccp_soft_pwm_t *_soft_pwm, ccp_soft_pwm_state_t *_state);
+#endif
+
+#if CCP_SERVO_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the servo pins low with centred pulses and start the frame timing.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Note                : The CCP is initialized in Compare mode with its interrupt and a free running timebase.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Init(const ccp_servo_t *_servo, ccp_servo_state_t *_state);
+
+/*
+ * @Brief               : To set the pulse width of one servo.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Param _index        : Servo index in the configuration pins.
+ * @Param _pulse_us     : Pulse width from CCP_SERVO_CFG_MIN_PULSE_US to CCP_SERVO_CFG_MAX_PULSE_US.
+ * @Note                : The new pulse widths are output after CCP_Servo_Update, at a frame start.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Set_Pulse(const ccp_servo_t *_servo, ccp_servo_state_t *_state, 
+                                   uint8 _index, uint16 _pulse_us);
+
+/*
+ * @Brief               : To hand the pulse widths set together to the next frame, called from the main loop.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_Servo_Update(const ccp_servo_t *_servo, ccp_servo_state_t *_state);
+
+/*
+ * @Brief               : To end the running pulse, start the next one and arm its end,
+ *                        called from the CCP1 or CCP2 interrupt handler.
+ * @Param _servo        : Pointer to the servo driver configurations.
+ * @Param _state        : Pointer to the servo driver state.
+ * @Note                : An edge closer than CCP_SERVO_CFG_MIN_LEAD_TICKS is pushed forward, that pulse is longer.
+ */
+void CCP_Servo_ISR(const ccp_servo_t *_servo, ccp_servo_state_t *_state);
+#endif
+
+#if CCP_DDS_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To initialize the DDS at 0 Hz, the PWM output stays at the middle duty cycle.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Note                : The CCP is initialized before in PWM mode and Timer2 with its interrupt, the
+ *                        sample rate is taken from PR2 and the Timer2 pre-scaler and post-scaler.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action, or the sample rate
+ *                        is above CCP_DDS_MAX_SAMPLE_RATE, the rate the CPU can serve.
+ */
+Std_ReturnType CCP_DDS_Init(const ccp_t *_ccp_obj, ccp_dds_t *_dds);
+
+/*
+ * @Brief               : To set the DDS output frequency.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Param _frequency_hz : Output frequency in Hz, up to half the sample rate.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_DDS_Set_Frequency(ccp_dds_t *_dds, uint32 _frequency_hz);
+
+/*
+ * @Brief               : To set the DDS phase step directly, for the sample_rate / 2^32 frequency resolution.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Param _phase_step   : Phase step, output frequency = _phase_step * sample_rate / 2^32.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_DDS_Set_Phase_Step(ccp_dds_t *_dds, uint32 _phase_step);
+
+/*
+ * @Brief               : To step the phase and write the next sine sample to the PWM duty cycle,
+ *                        called from the Timer2 interrupt handler.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _dds          : Pointer to the DDS state.
+ * @Note                : No loop and no division, every sample takes the same time.
+ */
+void CCP_DDS_ISR(const ccp_t *_ccp_obj, ccp_dds_t *_dds);
+#endif
+
+#if CCP1_ECCP_CFG==CONFIG_ENABLE
+/*
+ * @Brief               : To reverse the ECCP1 full-bridge without shoot-through.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Param _direction    : CCP_ECCP_FULL_BRIDGE_FORWARD or CCP_ECCP_FULL_BRIDGE_REVERSE.
+ * @Note                : The modulated outputs are held off for one PWM period around the swap,
+ *                        the function waits for one Timer2 period boundary with the Timer2 interrupt
+ *                        held off, so a duty ramp or DDS tick runs after the swap.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Set_Bridge_Direction(const ccp_t *_ccp_obj, uint8 _direction);
+
+/*
+ * @Brief                  : To check if ECCP1 outputs are shut down.
+ * @Param _ccp_obj         : Pointer to the CCP module configurations.
+ * @Param _shutdown_status : Pointer to the shutdown status @Ref : CCP_ECCP_SHUTDOWN_x.
+ * @Return Status of the function.
+ *          (E_OK)         : The function done successfully.
+ *          (E_NOT_OK)     : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Get_Shutdown_Status(const ccp_t *_ccp_obj, uint8 *_shutdown_status);
+
+/*
+ * @Brief               : To restart ECCP1 outputs after a shutdown when auto-restart is not used.
+ * @Param _ccp_obj      : Pointer to the CCP module configurations.
+ * @Note                : The outputs stay shut down while the shutdown source is still active.
+ * @Return Status of the function.
+ *          (E_OK)      : The function done successfully.
+ *          (E_NOT_OK)  : The function has issue while performing this action.
+ */
+Std_ReturnType CCP_ECCP_Restart(const ccp_t *_ccp_obj);
+#endif
 /***********************************************************************/
 #endif	/* HAL_CCP_H */
 
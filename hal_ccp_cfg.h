@@ -23,6 +23,90 @@
 #define CCP1_CFG_SELECTED_MODE (CCP_CFG_COMPARE_MODE_SELECTED)
 /* @Brief : Macro for CCP2 selected mode. */
 #define CCP2_CFG_SELECTED_MODE (CCP_CFG_COMPARE_MODE_SELECTED)
+
+/* 
+ * @Brief : Macro to enable the CCP1 enhanced PWM outputs (half-bridge, full-bridge, dead-band and auto-shutdown).
+ * @Note  : Needs CCP1 in PWM mode, P1B, P1C and P1D are RD5, RD6 and RD7.
+ */
+#define CCP1_ECCP_CFG                              CONFIG_DISABLE
+
+/* 
+ * @Brief : Macro to enable the interrupt driven input capture engine (period, high time and low time).
+ * @Note  : CCP_Capture_Engine_ISR is called from the CCP1 or CCP2 interrupt handler and
+ *          CCP_Timebase_Timer1_Overflow or CCP_Timebase_Timer3_Overflow from the capture timebase interrupt.
+ */
+#define CCP_CAPTURE_ENGINE_CFG                     CONFIG_DISABLE
+/* @Brief : Macro for the number of last measurements kept by each capture engine, power of 2. */
+#define CCP_CAPTURE_ENGINE_BUFFER_SIZE             8
+
+/* 
+ * @Brief : Macro to enable the output compare event scheduler.
+ * @Note  : CCP_Compare_Scheduler_ISR is called from the CCP1 or CCP2 interrupt handler and
+ *          CCP_Timebase_Timer1_Overflow or CCP_Timebase_Timer3_Overflow from the compare timebase interrupt.
+ */
+#define CCP_COMPARE_SCHEDULER_CFG                  CONFIG_DISABLE
+/* @Brief : Macro for the number of pending events of each compare scheduler, power of 2. */
+#define CCP_COMPARE_SCHEDULER_QUEUE_SIZE           8
+/* @Brief : Macro for the timebase ticks needed to arm an event, closer events are done at once by software. */
+#define CCP_COMPARE_SCHEDULER_MIN_LEAD_TICKS       200
+
+/* 
+ * @Brief : Macro to enable the multi-channel software PWM on one CCP compare channel.
+ * @Note  : CCP_Soft_PWM_ISR is called from the CCP1 or CCP2 interrupt handler.
+ */
+#define CCP_SOFT_PWM_CFG                           CONFIG_DISABLE
+/* @Brief : Macro for the maximum number of software PWM channels. */
+#define CCP_SOFT_PWM_CFG_MAX_CHANNELS              16
+/* @Brief : Macro for the timebase ticks of one duty cycle step, 255 steps make the period (78 : 100 Hz at 2 MHz). */
+#define CCP_SOFT_PWM_CFG_STEP_TICKS                78
+/* @Brief : Macro for the timebase ticks needed to arm an edge, closer edges are done in the same interrupt. */
+#define CCP_SOFT_PWM_CFG_MIN_LEAD_TICKS            40
+
+/* 
+ * @Brief : Macro to enable the multiplexed RC servo driver on one CCP compare channel.
+ * @Note  : CCP_Servo_ISR is called from the CCP1 or CCP2 interrupt handler.
+ */
+#define CCP_SERVO_CFG                              CONFIG_DISABLE
+/* @Brief : Macro for the maximum number of servos sharing the frame. */
+#define CCP_SERVO_CFG_MAX_SERVOS                   8
+/* @Brief : Macro for the timebase ticks in one microsecond (2 : 8 MHz with pre-scaler 1). */
+#define CCP_SERVO_CFG_TICKS_PER_US                 2UL
+/* @Brief : Macros for the servo frame and pulse limits in microseconds. */
+#define CCP_SERVO_CFG_FRAME_US                     20000UL
+#define CCP_SERVO_CFG_MIN_PULSE_US                 1000UL
+#define CCP_SERVO_CFG_MAX_PULSE_US                 2000UL
+/* @Brief : Macro for the timebase ticks needed to arm a slot edge, closer edges are pushed forward by this lead. */
+#define CCP_SERVO_CFG_MIN_LEAD_TICKS               40
+
+/*
+ * @Brief : Macro to enable the direct digital synthesis sine generator on the CCP PWM duty cycle.
+ * @Note  : CCP_DDS_ISR is called from the Timer2 interrupt handler, one sample every Timer2 post-scaler
+ *          periods. PR2 = 63 with pre-scaler 1 and post-scaler 8 give an 8-Bit duty cycle at 31.25 kHz
+ *          and 3906 samples per second at 8 MHz, for sine outputs up to a few hundred Hz after an RC filter.
+ */
+#define CCP_DDS_CFG                                CONFIG_DISABLE
+/*
+ * @Brief : Macro for the instruction cycles of one DDS sample, interrupt entry included.
+ * @Note  : About 150 instruction cycles run before CCP_DDS_ISR : 50 for the context save and restore,
+ *          70 for the interrupt manager flag checks ahead of Timer2 and 30 for TMR2_ISR and the Timer2
+ *          callback. CCP_DDS_ISR adds about 100 : 10 for the 32-Bit phase add, 25 for the table read and
+ *          mirroring, 30 for the 8x16 multiply and shift and 35 for the duty cycle write.
+ */
+#define CCP_DDS_CFG_SAMPLE_CYCLES                  250UL
+
+/* 
+ * @Brief : Macro to enable the compile-time PWM frequency planner.
+ * @Note  : PR2 and the Timer2 pre-scaler are taken from CCP_PWM_PLAN_PR2 and CCP_PWM_PLAN_PRESCALER,
+ *          the ccp_t PWM frequency and scalers fields are not used.
+ */
+#define CCP_PWM_PLANNER_CFG                        CONFIG_DISABLE
+
+/* @Brief : Macro for the PWM target frequency in Hz. */
+#define CCP_PWM_CFG_TARGET_FREQUENCY               20000UL
+/* @Brief : Macro for the accepted error of the achieved PWM frequency in per-mille of the target. */
+#define CCP_PWM_CFG_FREQUENCY_TOLERANCE_PERMILLE   10UL
+/* @Brief : Macro for the minimum accepted duty cycle resolution in bits. */
+#define CCP_PWM_CFG_MIN_RESOLUTION_BITS            8
 /***********************************************************************/
 
 /******************Macro Function Declarations-Section******************/
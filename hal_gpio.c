@@ -298,4 +298,35 @@ Std_ReturnType gpio_port_toggle_logic(port_index_t port)
     return ret;
 }
 #endif
+
+/*
+ * @Brief              : To write logic on a group of pins of the same port with one latch update.
+ * @Param port
+ * @Param mask         : Bit-Mask of the pins to be updated, other pins keep their logic.
+ * @Param logic        : Logic of the masked pins, already shifted to their pin positions.
+ * @Note               : The latch read-modify-write runs with interrupts disabled, so a pin of the same 
+ *                       port written from an interrupt is not lost.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+#if GPIO_PORT_CONFIGURATIONS==CONFIG_ENABLE
+Std_ReturnType gpio_port_write_logic_masked(port_index_t port, uint8 mask, uint8 logic)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_interrupt_status = ZERO_INT;
+    if(port > PORT_MAX_NUMBER-1)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *lat_registers[port] = (*lat_registers[port] & (uint8)(~mask)) | (logic & mask);
+        INTCONbits.GIE = l_interrupt_status;
+    }
+    return ret;
+}
+#endif
 /***********************************************************************/
\ No newline at end of file
@@ -89,6 +89,9 @@ typedef struct
     uint8 direction : 1; /* @Ref : direction_t */
     uint8 logic : 1;     /* @Ref : logic_t */
 }pin_config_t;
+
+/* @Brief : Data latch registers of PORTA to PORTE, for pins written from a time critical interrupt. */
+extern volatile uint8 *lat_registers[];
 /***********************************************************************/
 
 /**********Software Interfaces Functions Declarations-Section***********/
@@ -197,5 +200,18 @@ Std_ReturnType gpio_port_read_logic(port_index_t port, uint8 *logic);
  *          (E_NOT_OK) : The function has issue to perform this action.
  */
 Std_ReturnType gpio_port_toggle_logic(port_index_t port);
+
+/*
+ * @Brief              : To write logic on a group of pins of the same port with one latch update.
+ * @Param port
+ * @Param mask         : Bit-Mask of the pins to be updated, other pins keep their logic.
+ * @Param logic        : Logic of the masked pins, already shifted to their pin positions.
+ * @Note               : The latch read-modify-write runs with interrupts disabled, so a pin of the same 
+ *                       port written from an interrupt is not lost.
+ * @Return Status of the function.
+ *          (E_OK)     : The function done successfully.
+ *          (E_NOT_OK) : The function has issue to perform this action.
+ */
+Std_ReturnType gpio_port_write_logic_masked(port_index_t port, uint8 mask, uint8 logic);
 /***********************************************************************/
 #endif	/* HAL_GPIO_H */
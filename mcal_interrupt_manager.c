@@ -120,6 +120,12 @@ void __interrupt() InterruptManager(void)
         RB7_ISR(1);
     }
     else{/*****Nothing*****/}
+    /* @Brief : The change ended before PORTB was read, clear the flag so the interrupt does not stay pending. */
+    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF))
+    {
+        INTCONbits.RBIF = 0;
+    }
+    else{/*****Nothing*****/}
     /***********************************************************************/
     
     /************************ADC modules interrupt**************************/